@@ -146,6 +146,7 @@ static void k_info_reset(bool empty)
         k_ptr->tried = FALSE;
         k_ptr->aware = FALSE;
     }
+    object_desc_invalidate();
 }
 
 static void a_info_reset(bool empty)
@@ -230,6 +231,7 @@ static void player_wipe(void)
         r_ptr->flagsr &= ~(RFR_PACT_MONSTER);
         r_ptr->r_flagsr &= ~(RFR_PACT_MONSTER);
     }
+    mon_race_props_invalidate();
 
 
     /* Hack -- Well fed player */
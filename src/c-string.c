@@ -1,4 +1,5 @@
 #include "c-string.h"
+#include "z-virt.h"
 
 #include <assert.h>
 #include <stdlib.h>
@@ -42,9 +43,9 @@ string_ptr string_alloc_format(const char *fmt, ...)
 
 string_ptr string_alloc_size(int size)
 {
-    string_ptr res = malloc(sizeof(string_t));
+    string_ptr res = slab_alloc(sizeof(string_t));
 
-    res->buf = malloc(size + 1);
+    res->buf = slab_alloc(size + 1);
     res->len = 0;
     res->buf[0] = '\0';
     res->size = size + 1;
@@ -66,10 +67,10 @@ string_ptr string_copy_s(const char *val)
 
 string_ptr string_copy_sn(const char *val, int cb)
 {
-    string_ptr res = malloc(sizeof(string_t));
+    string_ptr res = slab_alloc(sizeof(string_t));
 
     assert(val);
-    res->buf = malloc(cb + 1);
+    res->buf = slab_alloc(cb + 1);
     memcpy(res->buf, val, cb);
     res->len = cb;
     res->buf[res->len] = '\0';
@@ -81,8 +82,8 @@ void string_free(string_ptr str)
 {
     if (str)
     {
-        free(str->buf);
-        free(str);
+        slab_free(str->buf, str->size);
+        slab_free(str, sizeof(string_t));
     }
 }
 
@@ -225,9 +226,9 @@ void string_grow(string_ptr str, int size)
         if (new_size < size)
             new_size = size;
 
-        buf = malloc(new_size);
+        buf = slab_alloc(new_size);
         memcpy(buf, str->buf, str->size);
-        free(str->buf);
+        slab_free(str->buf, str->size);
 
         str->size = new_size;
         str->buf = buf;
@@ -273,9 +274,9 @@ void string_shrink(string_ptr str, int size)
         if (size < cb)
             size = cb;
 
-        buf = malloc(size);
+        buf = slab_alloc(size);
         memcpy(buf, str->buf, cb);
-        free(str->buf);
+        slab_free(str->buf, str->size);
 
         str->size = size;
         str->buf = buf;
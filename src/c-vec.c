@@ -1,4 +1,5 @@
 #include "c-vec.h"
+#include "z-virt.h"
 
 #include <assert.h>
 #include <math.h>
@@ -43,25 +44,26 @@ static void _grow(vec_ptr vec, int size)
     if (size > vec->size)
     {
         vptr   *old_objs = vec->objs;
+        int     old_size = vec->size;
         int     i;
 
         vec->size = vec->size * 2;
         if (vec->size < size)
             vec->size = size;
 
-        vec->objs = malloc(vec->size * sizeof(vptr));
+        vec->objs = slab_alloc(vec->size * sizeof(vptr));
         memset(vec->objs, 0, vec->size * sizeof(vptr)); /* unnecessary */
 
         for (i = 0; i < vec->len; i++)
             vec->objs[i] = old_objs[i];
 
-        free(old_objs);
+        slab_free(old_objs, old_size * sizeof(vptr));
     }
 }
 
 vec_ptr vec_alloc(vec_free_f free)
 {
-    vec_ptr result = malloc(sizeof(vec_t));
+    vec_ptr result = slab_alloc(sizeof(vec_t));
     result->objs = 0;
     result->size = 0;
     result->len = 0;
@@ -74,8 +76,8 @@ void vec_free(vec_ptr vec)
     if (vec)
     {
         vec_clear(vec);
-        free(vec->objs);
-        free(vec);
+        slab_free(vec->objs, vec->size * sizeof(vptr));
+        slab_free(vec, sizeof(vec_t));
     }
 }
 
@@ -323,8 +325,8 @@ static void _merge(vptr vec[], int p, int q, int r, vec_cmp_f f)
 {
     int n1 = q - p + 1;
     int n2 = r - q;
-    vptr *ls = malloc(n1 * sizeof(vptr));
-    vptr *rs = malloc(n2 * sizeof(vptr));
+    vptr *ls = slab_alloc(n1 * sizeof(vptr));
+    vptr *rs = slab_alloc(n2 * sizeof(vptr));
     int i1 = 0, i2 = 0, i;
 
     for (i1 = 0; i1 < n1; i1++)
@@ -348,8 +350,8 @@ static void _merge(vptr vec[], int p, int q, int r, vec_cmp_f f)
         vec[i] = c;
     }
 
-    free(ls);
-    free(rs);
+    slab_free(ls, n1 * sizeof(vptr));
+    slab_free(rs, n2 * sizeof(vptr));
 }
 
 static void _merge_sort(vptr vec[], int left, int right, vec_cmp_f f)
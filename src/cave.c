@@ -2508,6 +2508,14 @@ void do_cmd_view_map(void)
 
 
 
+/*
+ * Monster light depends on the player's view and torch light and on the
+ * terrain around each light source (see update_mon_lite() below). Bumped
+ * whenever one of those changes so update_mon_lite() knows when its last
+ * result can be reused.
+ */
+static u32b _mon_lite_epoch = 0;
+
 /*
  * Actually erase the entire "lite" array, redrawing every grid
  */
@@ -2515,6 +2523,8 @@ void forget_lite(void)
 {
     int i, x, y;
 
+    _mon_lite_epoch++;
+
     /* None to forget */
     if (!lite_n) return;
 
@@ -2780,6 +2790,7 @@ void update_lite(void)
 
         /* Add it to later visual update */
         cave_note_and_redraw_later(c_ptr, y, x);
+        _mon_lite_epoch++;
     }
 
     /* Clear them all */
@@ -2798,6 +2809,7 @@ void update_lite(void)
 
         /* Add it to later visual update */
         cave_redraw_later(c_ptr, y, x);
+        _mon_lite_epoch++;
     }
 
     /* None left */
@@ -2970,6 +2982,80 @@ static void mon_dark_hack(int y, int x)
 }
 
 
+/*
+ * Light sources found by update_mon_lite(): the monster's grid and its
+ * effective radius (negative for darkness).
+ */
+typedef struct {
+    s16b fy, fx;
+    s16b rad;
+} _mon_lite_src_t, *_mon_lite_src_ptr;
+
+static _mon_lite_src_ptr _mon_lite_src = NULL;
+static _mon_lite_src_ptr _mon_lite_old = NULL;
+static int _mon_lite_old_n = 0;
+static bool _mon_lite_valid = FALSE;
+static u32b _mon_lite_old_epoch = 0;
+static s16b _mon_lite_py, _mon_lite_px;
+
+static int _mon_lite_collect(void)
+{
+    int i, rad, n = 0;
+
+    /* Non-Ninja player in the darkness */
+    int dis_lim = ((d_info[dungeon_type].flags1 & DF1_DARKNESS) && !p_ptr->see_nocto) ?
+        (MAX_SIGHT / 2 + 1) : (MAX_SIGHT + 3);
+
+    if (!_mon_lite_src)
+    {
+        _mon_lite_src = malloc(max_m_idx * sizeof(_mon_lite_src_t));
+        _mon_lite_old = malloc(max_m_idx * sizeof(_mon_lite_src_t));
+    }
+
+    /* If a monster stops time, don't process */
+    if (world_monster) return 0;
+
+    for (i = 1; i < m_max; i++)
+    {
+        monster_type *m_ptr = &m_list[i];
+        monster_race *r_ptr = &r_info[m_ptr->r_idx];
+        _mon_lite_src_ptr src;
+
+        /* Skip dead monsters */
+        if (!m_ptr->r_idx) continue;
+
+        /* Is it too far away? */
+        if (m_ptr->cdis > dis_lim) continue;
+
+        /* Get lite radius */
+        rad = 0;
+
+        /* Note the radii are cumulative */
+        if (r_ptr->flags7 & (RF7_HAS_LITE_1 | RF7_SELF_LITE_1)) rad++;
+        if (r_ptr->flags7 & (RF7_HAS_LITE_2 | RF7_SELF_LITE_2)) rad += 2;
+        if (r_ptr->flags7 & (RF7_HAS_DARK_1 | RF7_SELF_DARK_1)) rad--;
+        if (r_ptr->flags7 & (RF7_HAS_DARK_2 | RF7_SELF_DARK_2)) rad -= 2;
+
+        /* Exit if has no light */
+        if (!rad) continue;
+        else if (rad > 0)
+        {
+            if (!(r_ptr->flags7 & (RF7_SELF_LITE_1 | RF7_SELF_LITE_2)) && (MON_CSLEEP(m_ptr) || (!dun_level && is_daytime()) || p_ptr->inside_battle)) continue;
+            if (d_info[dungeon_type].flags1 & DF1_DARKNESS) rad = 1;
+        }
+        else
+        {
+            if (!(r_ptr->flags7 & (RF7_SELF_DARK_1 | RF7_SELF_DARK_2)) && (MON_CSLEEP(m_ptr) || (!dun_level && !is_daytime()))) continue;
+        }
+
+        src = &_mon_lite_src[n++];
+        src->fy = m_ptr->fy;
+        src->fx = m_ptr->fx;
+        src->rad = rad;
+    }
+    return n;
+}
+
 /*
  * Update squares illuminated or darkened by monsters.
  *
@@ -2980,7 +3066,7 @@ static void mon_dark_hack(int y, int x)
  * updating. Only squares in view of the player, whos state
  * changes are drawn via lite_spot().
  */
-void update_mon_lite(void)
+static void _mon_lite_stamp(int src_n)
 {
     int i, rad;
     cave_type *c_ptr;
@@ -2991,10 +3077,6 @@ void update_mon_lite(void)
 
     s16b end_temp;
 
-    /* Non-Ninja player in the darkness */
-    int dis_lim = ((d_info[dungeon_type].flags1 & DF1_DARKNESS) && !p_ptr->see_nocto) ?
-        (MAX_SIGHT / 2 + 1) : (MAX_SIGHT + 3);
-
     /* Clear all monster lit squares */
     for (i = 0; i < mon_lite_n; i++)
     {
@@ -3011,172 +3093,145 @@ void update_mon_lite(void)
     /* Empty temp list of new squares to lite up */
     temp_n = 0;
 
-    /* If a monster stops time, don't process */
-    if (!world_monster)
+    /* Loop through the light sources, adding newly lit squares to changes list */
+    for (i = 0; i < src_n; i++)
     {
-        monster_type *m_ptr;
-        monster_race *r_ptr;
+        _mon_lite_src_ptr src = &_mon_lite_src[i];
 
-        /* Loop through monsters, adding newly lit squares to changes list */
-        for (i = 1; i < m_max; i++)
+        rad = src->rad;
+        if (rad > 0)
         {
-            m_ptr = &m_list[i];
-            r_ptr = &r_info[m_ptr->r_idx];
+            add_mon_lite = mon_lite_hack;
+            f_flag = FF_LOS;
+        }
+        else
+        {
+            add_mon_lite = mon_dark_hack;
+            f_flag = FF_PROJECT;
+            rad = -rad; /* Use absolute value */
+        }
 
-            /* Skip dead monsters */
-            if (!m_ptr->r_idx) continue;
+        /* Access the location */
+        mon_fx = src->fx;
+        mon_fy = src->fy;
 
-            /* Is it too far away? */
-            if (m_ptr->cdis > dis_lim) continue;
+        /* Is the monster visible? */
+        mon_invis = !(cave[mon_fy][mon_fx].info & CAVE_VIEW);
 
-            /* Get lite radius */
-            rad = 0;
+        /* The square it is on */
+        add_mon_lite(mon_fy, mon_fx);
 
-            /* Note the radii are cumulative */
-            if (r_ptr->flags7 & (RF7_HAS_LITE_1 | RF7_SELF_LITE_1)) rad++;
-            if (r_ptr->flags7 & (RF7_HAS_LITE_2 | RF7_SELF_LITE_2)) rad += 2;
-            if (r_ptr->flags7 & (RF7_HAS_DARK_1 | RF7_SELF_DARK_1)) rad--;
-            if (r_ptr->flags7 & (RF7_HAS_DARK_2 | RF7_SELF_DARK_2)) rad -= 2;
+        /* Adjacent squares */
+        add_mon_lite(mon_fy + 1, mon_fx);
+        add_mon_lite(mon_fy - 1, mon_fx);
+        add_mon_lite(mon_fy, mon_fx + 1);
+        add_mon_lite(mon_fy, mon_fx - 1);
+        add_mon_lite(mon_fy + 1, mon_fx + 1);
+        add_mon_lite(mon_fy + 1, mon_fx - 1);
+        add_mon_lite(mon_fy - 1, mon_fx + 1);
+        add_mon_lite(mon_fy - 1, mon_fx - 1);
 
-            /* Exit if has no light */
-            if (!rad) continue;
-            else if (rad > 0)
-            {
-                if (!(r_ptr->flags7 & (RF7_SELF_LITE_1 | RF7_SELF_LITE_2)) && (MON_CSLEEP(m_ptr) || (!dun_level && is_daytime()) || p_ptr->inside_battle)) continue;
-                if (d_info[dungeon_type].flags1 & DF1_DARKNESS) rad = 1;
-                add_mon_lite = mon_lite_hack;
-                f_flag = FF_LOS;
-            }
-            else
+        /* Radius 2 */
+        if (rad >= 2)
+        {
+            /* South of the monster */
+            if (cave_have_flag_bold(mon_fy + 1, mon_fx, f_flag))
             {
-                if (!(r_ptr->flags7 & (RF7_SELF_DARK_1 | RF7_SELF_DARK_2)) && (MON_CSLEEP(m_ptr) || (!dun_level && !is_daytime()))) continue;
-                add_mon_lite = mon_dark_hack;
-                f_flag = FF_PROJECT;
-                rad = -rad; /* Use absolute value */
-            }
-
-            /* Access the location */
-            mon_fx = m_ptr->fx;
-            mon_fy = m_ptr->fy;
-
-            /* Is the monster visible? */
-            mon_invis = !(cave[mon_fy][mon_fx].info & CAVE_VIEW);
-
-            /* The square it is on */
-            add_mon_lite(mon_fy, mon_fx);
+                add_mon_lite(mon_fy + 2, mon_fx + 1);
+                add_mon_lite(mon_fy + 2, mon_fx);
+                add_mon_lite(mon_fy + 2, mon_fx - 1);
 
-            /* Adjacent squares */
-            add_mon_lite(mon_fy + 1, mon_fx);
-            add_mon_lite(mon_fy - 1, mon_fx);
-            add_mon_lite(mon_fy, mon_fx + 1);
-            add_mon_lite(mon_fy, mon_fx - 1);
-            add_mon_lite(mon_fy + 1, mon_fx + 1);
-            add_mon_lite(mon_fy + 1, mon_fx - 1);
-            add_mon_lite(mon_fy - 1, mon_fx + 1);
-            add_mon_lite(mon_fy - 1, mon_fx - 1);
+                c_ptr = &cave[mon_fy + 2][mon_fx];
 
-            /* Radius 2 */
-            if (rad >= 2)
-            {
-                /* South of the monster */
-                if (cave_have_flag_bold(mon_fy + 1, mon_fx, f_flag))
+                /* Radius 3 */
+                if ((rad == 3) && cave_have_flag_grid(c_ptr, f_flag))
                 {
-                    add_mon_lite(mon_fy + 2, mon_fx + 1);
-                    add_mon_lite(mon_fy + 2, mon_fx);
-                    add_mon_lite(mon_fy + 2, mon_fx - 1);
-
-                    c_ptr = &cave[mon_fy + 2][mon_fx];
-
-                    /* Radius 3 */
-                    if ((rad == 3) && cave_have_flag_grid(c_ptr, f_flag))
-                    {
-                        add_mon_lite(mon_fy + 3, mon_fx + 1);
-                        add_mon_lite(mon_fy + 3, mon_fx);
-                        add_mon_lite(mon_fy + 3, mon_fx - 1);
-                    }
+                    add_mon_lite(mon_fy + 3, mon_fx + 1);
+                    add_mon_lite(mon_fy + 3, mon_fx);
+                    add_mon_lite(mon_fy + 3, mon_fx - 1);
                 }
+            }
 
-                /* North of the monster */
-                if (cave_have_flag_bold(mon_fy - 1, mon_fx, f_flag))
-                {
-                    add_mon_lite(mon_fy - 2, mon_fx + 1);
-                    add_mon_lite(mon_fy - 2, mon_fx);
-                    add_mon_lite(mon_fy - 2, mon_fx - 1);
+            /* North of the monster */
+            if (cave_have_flag_bold(mon_fy - 1, mon_fx, f_flag))
+            {
+                add_mon_lite(mon_fy - 2, mon_fx + 1);
+                add_mon_lite(mon_fy - 2, mon_fx);
+                add_mon_lite(mon_fy - 2, mon_fx - 1);
 
-                    c_ptr = &cave[mon_fy - 2][mon_fx];
+                c_ptr = &cave[mon_fy - 2][mon_fx];
 
-                    /* Radius 3 */
-                    if ((rad == 3) && cave_have_flag_grid(c_ptr, f_flag))
-                    {
-                        add_mon_lite(mon_fy - 3, mon_fx + 1);
-                        add_mon_lite(mon_fy - 3, mon_fx);
-                        add_mon_lite(mon_fy - 3, mon_fx - 1);
-                    }
+                /* Radius 3 */
+                if ((rad == 3) && cave_have_flag_grid(c_ptr, f_flag))
+                {
+                    add_mon_lite(mon_fy - 3, mon_fx + 1);
+                    add_mon_lite(mon_fy - 3, mon_fx);
+                    add_mon_lite(mon_fy - 3, mon_fx - 1);
                 }
+            }
 
-                /* East of the monster */
-                if (cave_have_flag_bold(mon_fy, mon_fx + 1, f_flag))
-                {
-                    add_mon_lite(mon_fy + 1, mon_fx + 2);
-                    add_mon_lite(mon_fy, mon_fx + 2);
-                    add_mon_lite(mon_fy - 1, mon_fx + 2);
+            /* East of the monster */
+            if (cave_have_flag_bold(mon_fy, mon_fx + 1, f_flag))
+            {
+                add_mon_lite(mon_fy + 1, mon_fx + 2);
+                add_mon_lite(mon_fy, mon_fx + 2);
+                add_mon_lite(mon_fy - 1, mon_fx + 2);
 
-                    c_ptr = &cave[mon_fy][mon_fx + 2];
+                c_ptr = &cave[mon_fy][mon_fx + 2];
 
-                    /* Radius 3 */
-                    if ((rad == 3) && cave_have_flag_grid(c_ptr, f_flag))
-                    {
-                        add_mon_lite(mon_fy + 1, mon_fx + 3);
-                        add_mon_lite(mon_fy, mon_fx + 3);
-                        add_mon_lite(mon_fy - 1, mon_fx + 3);
-                    }
+                /* Radius 3 */
+                if ((rad == 3) && cave_have_flag_grid(c_ptr, f_flag))
+                {
+                    add_mon_lite(mon_fy + 1, mon_fx + 3);
+                    add_mon_lite(mon_fy, mon_fx + 3);
+                    add_mon_lite(mon_fy - 1, mon_fx + 3);
                 }
+            }
 
-                /* West of the monster */
-                if (cave_have_flag_bold(mon_fy, mon_fx - 1, f_flag))
-                {
-                    add_mon_lite(mon_fy + 1, mon_fx - 2);
-                    add_mon_lite(mon_fy, mon_fx - 2);
-                    add_mon_lite(mon_fy - 1, mon_fx - 2);
+            /* West of the monster */
+            if (cave_have_flag_bold(mon_fy, mon_fx - 1, f_flag))
+            {
+                add_mon_lite(mon_fy + 1, mon_fx - 2);
+                add_mon_lite(mon_fy, mon_fx - 2);
+                add_mon_lite(mon_fy - 1, mon_fx - 2);
 
-                    c_ptr = &cave[mon_fy][mon_fx - 2];
+                c_ptr = &cave[mon_fy][mon_fx - 2];
 
-                    /* Radius 3 */
-                    if ((rad == 3) && cave_have_flag_grid(c_ptr, f_flag))
-                    {
-                        add_mon_lite(mon_fy + 1, mon_fx - 3);
-                        add_mon_lite(mon_fy, mon_fx - 3);
-                        add_mon_lite(mon_fy - 1, mon_fx - 3);
-                    }
+                /* Radius 3 */
+                if ((rad == 3) && cave_have_flag_grid(c_ptr, f_flag))
+                {
+                    add_mon_lite(mon_fy + 1, mon_fx - 3);
+                    add_mon_lite(mon_fy, mon_fx - 3);
+                    add_mon_lite(mon_fy - 1, mon_fx - 3);
                 }
             }
+        }
 
-            /* Radius 3 */
-            if (rad == 3)
+        /* Radius 3 */
+        if (rad == 3)
+        {
+            /* South-East of the monster */
+            if (cave_have_flag_bold(mon_fy + 1, mon_fx + 1, f_flag))
             {
-                /* South-East of the monster */
-                if (cave_have_flag_bold(mon_fy + 1, mon_fx + 1, f_flag))
-                {
-                    add_mon_lite(mon_fy + 2, mon_fx + 2);
-                }
+                add_mon_lite(mon_fy + 2, mon_fx + 2);
+            }
 
-                /* South-West of the monster */
-                if (cave_have_flag_bold(mon_fy + 1, mon_fx - 1, f_flag))
-                {
-                    add_mon_lite(mon_fy + 2, mon_fx - 2);
-                }
+            /* South-West of the monster */
+            if (cave_have_flag_bold(mon_fy + 1, mon_fx - 1, f_flag))
+            {
+                add_mon_lite(mon_fy + 2, mon_fx - 2);
+            }
 
-                /* North-East of the monster */
-                if (cave_have_flag_bold(mon_fy - 1, mon_fx + 1, f_flag))
-                {
-                    add_mon_lite(mon_fy - 2, mon_fx + 2);
-                }
+            /* North-East of the monster */
+            if (cave_have_flag_bold(mon_fy - 1, mon_fx + 1, f_flag))
+            {
+                add_mon_lite(mon_fy - 2, mon_fx + 2);
+            }
 
-                /* North-West of the monster */
-                if (cave_have_flag_bold(mon_fy - 1, mon_fx - 1, f_flag))
-                {
-                    add_mon_lite(mon_fy - 2, mon_fx - 2);
-                }
+            /* North-West of the monster */
+            if (cave_have_flag_bold(mon_fy - 1, mon_fx - 1, f_flag))
+            {
+                add_mon_lite(mon_fy - 2, mon_fx - 2);
             }
         }
     }
@@ -3278,6 +3333,38 @@ void update_mon_lite(void)
 
     /* Mega-Hack -- Visual update later */
     p_ptr->update |= (PU_DELAY_VIS);
+}
+
+/*
+ * Recompute monster light, but only if some light source moved, appeared
+ * or went out, or if the view, torch light or terrain changed since the
+ * last pass (see _mon_lite_epoch). Otherwise the lit grids are still
+ * correct and the whole clear and restamp cycle is skipped.
+ */
+void update_mon_lite(void)
+{
+    int n = _mon_lite_collect();
+
+    if ( !_mon_lite_valid
+      || _mon_lite_old_epoch != _mon_lite_epoch
+      || _mon_lite_py != py || _mon_lite_px != px
+      || _mon_lite_old_n != n
+      || (n && memcmp(_mon_lite_old, _mon_lite_src, n * sizeof(_mon_lite_src_t))) )
+    {
+        _mon_lite_src_ptr tmp;
+
+        _mon_lite_stamp(n);
+
+        /* Remember the sources for next time */
+        tmp = _mon_lite_old;
+        _mon_lite_old = _mon_lite_src;
+        _mon_lite_src = tmp;
+        _mon_lite_old_n = n;
+        _mon_lite_old_epoch = _mon_lite_epoch;
+        _mon_lite_py = py;
+        _mon_lite_px = px;
+        _mon_lite_valid = TRUE;
+    }
 
     p_ptr->monlite = (cave[py][px].info & CAVE_MNLT) ? TRUE : FALSE;
 
@@ -3303,6 +3390,8 @@ void clear_mon_lite(void)
     int i;
     cave_type *c_ptr;
 
+    _mon_lite_valid = FALSE;
+
     /* Clear all monster lit squares */
     for (i = 0; i < mon_lite_n; i++)
     {
@@ -3319,6 +3408,22 @@ void clear_mon_lite(void)
 
 
 
+/*
+ * The view only depends on the player's grid and on the "los" flags of the
+ * surrounding terrain (lighting is handled by update_lite() and friends).
+ * Remember where the current view was computed from so that the many
+ * PU_VIEW requests which change neither (torch and glow updates, opening
+ * a shop, etc.) don't redo the whole scan. Anything that changes terrain
+ * los must call invalidate_view() (or forget_view()).
+ */
+static bool _view_valid = FALSE;
+static int _view_py, _view_px, _view_hgt, _view_wid;
+
+void invalidate_view(void)
+{
+    _view_valid = FALSE;
+}
+
 /*
  * Clear the viewable space
  */
@@ -3328,6 +3433,10 @@ void forget_view(void)
 
     cave_type *c_ptr;
 
+    /* The cached view is gone */
+    _view_valid = FALSE;
+    _mon_lite_epoch++;
+
     /* None to forget */
     if (!view_n) return;
 
@@ -3487,6 +3596,29 @@ static bool update_view_aux(int y, int x, int y1, int x1, int y2, int x2)
 
 
 
+/*
+ * The "bounds" of the maximal circle for strip n of each octant (see
+ * Step 4 below). These only depend on MAX_SIGHT, so build them once.
+ */
+static s16b _view_strip_max[MAX_SIGHT * 3 / 4 + 1];
+static bool _view_strip_init = FALSE;
+
+static void _view_strip_prepare(void)
+{
+    int n, z;
+    int full = MAX_SIGHT;
+    int over = MAX_SIGHT * 3 / 2;
+
+    for (n = 1; n <= over / 2; n++)
+    {
+        z = over - n - n;
+        if (z > full - n) z = full - n;
+        while ((z + n + (n>>1)) > full) z--;
+        _view_strip_max[n] = z;
+    }
+    _view_strip_init = TRUE;
+}
+
 /*
  * Calculate the viewable space
  *
@@ -3599,6 +3731,19 @@ void update_view(void)
     /* Octagon factor (30) */
     over = MAX_SIGHT * 3 / 2;
 
+    /* Nothing changed since the last scan */
+    if ( _view_valid
+      && _view_py == py && _view_px == px
+      && _view_hgt == cur_hgt && _view_wid == cur_wid )
+    {
+        return;
+    }
+
+    if (!_view_strip_init) _view_strip_prepare();
+
+    /* CAVE_VIEW is about to change */
+    _mon_lite_epoch++;
+
 
     /*** Step 0 -- Begin ***/
 
@@ -3752,9 +3897,7 @@ void update_view(void)
 
 
         /* Acquire the "bounds" of the maximal circle */
-        z = over - n - n;
-        if (z > full - n) z = full - n;
-        while ((z + n + (n>>1)) > full) z--;
+        z = _view_strip_max[n];
 
 
         /* Access the four diagonal grids */
@@ -4024,6 +4167,13 @@ void update_view(void)
     /* None left */
     temp_n = 0;
 
+    /* Remember the origin of this view */
+    _view_valid = TRUE;
+    _view_py = py;
+    _view_px = px;
+    _view_hgt = cur_hgt;
+    _view_wid = cur_wid;
+
     /* Mega-Hack -- Visual update later */
     p_ptr->update |= (PU_DELAY_VIS);
 }
@@ -4585,6 +4735,7 @@ void cave_set_feat(int y, int x, int feat)
 
     /* Change the feature */
     c_ptr->feat = feat;
+    _mon_lite_epoch++;
 
     /* Remove flag for mirror/glyph */
     c_ptr->info &= ~(CAVE_OBJECT);
@@ -4612,6 +4763,9 @@ void cave_set_feat(int y, int x, int feat)
     /* Check if los has changed */
     if (old_los ^ have_flag(f_ptr->flags, FF_LOS))
     {
+        /* The view must be rescanned */
+        invalidate_view();
+
 
 #ifdef COMPLEX_WALL_ILLUMINATION /* COMPLEX_WALL_ILLUMINATION */
 
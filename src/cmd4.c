@@ -1745,6 +1745,9 @@ void do_cmd_options(void)
     /* Big fat hack */
     if (easy_mimics || old_easy_mimics) toggle_easy_mimics(easy_mimics);
 
+    /* Description options (abbrev_*, plain_descriptions, ...) */
+    object_desc_invalidate();
+
     /* Restore the screen */
     screen_load();
 
@@ -1133,19 +1133,13 @@ s16b tot_dam_aux(object_type *o_ptr, int tdam, monster_type *m_ptr, s16b hand, i
     return (tdam * mult / 10);
 }
 
-static int _critical_loop = 0;
-static int _critical_attempts = 0;
-static int _critical_roll = 0;
-static int _critical_comp = 0;
-
 /*
  * Critical hits (from bows/crossbows/slings)
  * Factor in item weight, total plusses, and player level.
  */
-critical_t critical_shot(int weight, int plus)
+static int _critical_shot_chance(int plus)
 {
-    critical_t result = {0};
-    int i, k;
+    int i;
 
     /* Extract "shot" power */
     i = (p_ptr->shooter_info.to_h + plus) * 3 + p_ptr->skills.thb * 2;
@@ -1159,8 +1153,16 @@ critical_t critical_shot(int weight, int plus)
         i *= 3;
     if (p_ptr->pclass == CLASS_ARCHER) i += i * p_ptr->lev / 100;
 
+    return i;
+}
+
+critical_t critical_shot(int weight, int plus)
+{
+    critical_t result = {0};
+    int k;
+
     /* Critical hit */
-    if (randint1(5000) <= i)
+    if (randint1(5000) <= _critical_shot_chance(plus))
     {
         k = weight * randint1(500);
         result.mul = 150 + k * 200 / 2000;
@@ -1184,34 +1186,33 @@ critical_t critical_shot(int weight, int plus)
  * Critical hits (from bows/crossbows/slings)
  * Factor in item weight, total plusses, and player level.
  */
+static int _critical_throw_chance(int plus)
+{
+    /* Extract "shot" power */
+    return (p_ptr->shooter_info.to_h + plus)*4 + p_ptr->lev*3;
+}
+
+static int _critical_throw_mul(int k)
+{
+    if (k < 400) return 150;
+    if (k < 700) return 200;
+    return 250;
+}
+
 critical_t critical_throw(int weight, int plus)
 {
     critical_t result = {0};
-    int i, k;
-
-    /* Extract "shot" power */
-    i = (p_ptr->shooter_info.to_h + plus)*4 + p_ptr->lev*3;
 
     /* Critical hit */
-    if (randint1(5000) <= i)
+    if (randint1(5000) <= _critical_throw_chance(plus))
     {
-        k = weight + randint1(650);
-
-        if (k < 400)
-        {
+        result.mul = _critical_throw_mul(weight + randint1(650));
+        if (result.mul == 150)
             result.desc = "It was a <color:y>good</color> hit!";
-            result.mul = 150;
-        }
-        else if (k < 700)
-        {
+        else if (result.mul == 200)
             result.desc = "It was a <color:R>great</color> hit!";
-            result.mul = 200;
-        }
         else
-        {
             result.desc = "It was a <color:r>superb</color> hit!";
-            result.mul = 250;
-        }
     }
 
     return result;
@@ -1228,37 +1229,22 @@ static bool _always_crit(int mode)
     else return FALSE;
 }
 
-static void _initialize_crit_loop(int mode)
-{
-    if ( mode == HISSATSU_MAJIN
-      || mode == HISSATSU_3DAN
-      || mode == MAULER_CRITICAL_BLOW) /* Extra randomness */
-    {
-        _critical_loop = -30;
-    }
-    else _critical_loop = -2; /* No randomness, why waste time */
-    _critical_attempts = 0;
-    _critical_roll = 0;
-    _critical_comp = 0;
-}
-
 /*
  * Critical hits (by player)
  *
  * Factor in weapon weight, total plusses, player level.
  */
-critical_t critical_norm(int weight, int plus, s16b meichuu, int mode, int hand)
+static int _critical_norm_chance(int *weight, int plus, s16b meichuu, int hand, int *roll, int *quality)
 {
-    critical_t result = {0};
     int i;
-    int roll = (player_is_ninja) ? 4444 : 5000;
-    int quality = 650;
-    static int next_k = 0;
+
+    *roll = (player_is_ninja) ? 4444 : 5000;
+    *quality = 650;
 
     if (p_ptr->enhanced_crit)
     {
-        weight = weight * 3 / 2;
-        weight += 300;
+        *weight = *weight * 3 / 2;
+        *weight += 300;
     }
 
     if ( equip_is_valid_hand(hand)
@@ -1266,96 +1252,209 @@ critical_t critical_norm(int weight, int plus, s16b meichuu, int mode, int hand)
       && p_ptr->pclass != CLASS_DUELIST
       && !p_ptr->weapon_info[hand].omoi )
     {
-        roll = roll * 4 / 5;
+        *roll = *roll * 4 / 5;
     }
 
     /* Extract "blow" power */
-    i = (weight + (meichuu * 3 + plus * 5) + (p_ptr->lev * 3));
+    i = (*weight + (meichuu * 3 + plus * 5) + (p_ptr->lev * 3));
 
     /* Mauler: Destroyer now scales with level */
     if ( p_ptr->pclass == CLASS_MAULER
       && equip_is_valid_hand(hand)
       && p_ptr->weapon_info[hand].wield_how == WIELD_TWO_HANDS )
     {
-        int pct = MIN((weight - 200)/20, 20);
+        int pct = MIN((*weight - 200)/20, 20);
         if (pct > 0)
             pct = pct * p_ptr->lev / 50;
-        i += roll * pct / 100;
-        quality += quality * pct / 100;
+        i += *roll * pct / 100;
+        *quality += *quality * pct / 100;
     }
 
-    if (_critical_loop < 0) /* Hack */
+    return i;
+}
+
+/* Extra randomness added to the quality roll k by some techniques:
+ * k += randint1(*max) if *max > 0 */
+static void _critical_norm_extra(int mode, int *max)
+{
+    *max = 0;
+    if ( mode == HISSATSU_MAJIN
+      || mode == HISSATSU_3DAN )
+    {
+        *max = 650;
+    }
+    if (mode == MAULER_CRITICAL_BLOW)
     {
-        _critical_loop = 0 - _critical_loop;
-        _critical_comp = i;
-        _critical_roll = _always_crit(mode) ? i : MAX(i, roll);
-        next_k = quality;
+        *max = MAX(1, 250*p_ptr->lev/50); /* randint1(0) is 1 */
     }
+}
+
+#define _NORM_CRIT_MAX 5
+static struct { int k; int mul; cptr desc; } _norm_crits[_NORM_CRIT_MAX] = {
+    {  400, 200, "It was a <color:y>good</color> hit!" },
+    {  700, 250, "It was a <color:R>great</color> hit!" },
+    {  900, 300, "It was a <color:r>superb</color> hit!" },
+    { 1300, 350, "It was a <color:v>*GREAT*</color> hit!" },
+    {    0, 400, "It was a <color:v>*SUPERB*</color> hit!" },
+};
+
+static int _critical_norm_mul(int which)
+{
+    int mul = _norm_crits[which].mul;
+
+    /* Golem criticals are too strong */
+    if (prace_is_(RACE_MON_GOLEM))
+        mul -= ((mul - 100) / 3);
+
+    return mul;
+}
+
+critical_t critical_norm(int weight, int plus, s16b meichuu, int mode, int hand)
+{
+    critical_t result = {0};
+    int i, roll, quality, extra;
+
+    i = _critical_norm_chance(&weight, plus, meichuu, hand, &roll, &quality);
 
     /* Chance */
     if ( _always_crit(mode)
-      || _critical_loop > 0
       || randint1(roll) <= i )
     {
-        int k;
-        if (_critical_loop)
-        {
-            k = weight + next_k;
-            next_k--;
-            if (next_k <= 0)
-            {
-                next_k = quality;
-                _critical_loop--;
-                if (!_critical_loop) return result;
-            }
-            _critical_attempts++;
-        }
-        else k = weight + randint1(quality);
+        int k = weight + randint1(quality);
+        int which;
 
-        if ( mode == HISSATSU_MAJIN
-          || mode == HISSATSU_3DAN )
-        {
-            k += randint1(650);
-        }
-        if (mode == MAULER_CRITICAL_BLOW)
-        {
-            k += randint1(250*p_ptr->lev/50);
-        }
+        _critical_norm_extra(mode, &extra);
+        if (extra) k += randint1(extra);
 
-        if (k < 400)
+        for (which = 0; which < _NORM_CRIT_MAX - 1; which++)
         {
-            result.desc = "It was a <color:y>good</color> hit!";
-            result.mul = 200;
-        }
-        else if (k < 700)
-        {
-            result.desc = "It was a <color:R>great</color> hit!";
-            result.mul = 250;
+            if (k < _norm_crits[which].k) break;
         }
-        else if (k < 900)
+        result.desc = _norm_crits[which].desc;
+        result.mul = _critical_norm_mul(which);
+    }
+
+    return result;
+}
+
+/*
+ * Closed form odds of the above for the character sheet and other displays
+ * (previously estimated by sampling the routines thousands of times).
+ */
+static int _clamp_chance(int chance, int roll)
+{
+    if (chance < 0) return 0;
+    if (chance > roll) return roll;
+    return chance;
+}
+
+critical_odds_t critical_shot_odds(int weight, int plus)
+{
+    critical_odds_t odds = {0};
+    s32b            tot = 0;
+    int             r;
+
+    odds.roll = 5000;
+    odds.chance = _clamp_chance(_critical_shot_chance(plus), odds.roll);
+
+    /* k = weight * randint1(500) */
+    for (r = 1; r <= 500; r++)
+        tot += 150 + weight * r * 200 / 2000;
+    odds.mul = (tot + 250) / 500;
+
+    return odds;
+}
+
+critical_odds_t critical_throw_odds(int weight, int plus)
+{
+    critical_odds_t odds = {0};
+    s32b            tot = 0;
+    int             r;
+
+    odds.roll = 5000;
+    odds.chance = _clamp_chance(_critical_throw_chance(plus), odds.roll);
+
+    /* k = weight + randint1(650) */
+    for (r = 1; r <= 650; r++)
+        tot += _critical_throw_mul(weight + r);
+    odds.mul = (tot + 325) / 650;
+
+    return odds;
+}
+
+/* Count the pairs (j, r) with 1 <= j <= jmax, 1 <= r <= rmax and
+ * base + j + r < k. With rmax == 0 there is no r (count j alone). */
+static s32b _count_below(int base, int jmax, int rmax, int k)
+{
+    s32b ct = 0;
+    int  j;
+
+    for (j = 1; j <= jmax; j++)
+    {
+        int room = k - base - j; /* need r < room */
+        if (!rmax)
         {
-            result.desc = "It was a <color:r>superb</color> hit!";
-            result.mul = 300;
+            if (room > 0) ct++;
         }
-        else if (k < 1300)
+        else if (room > 1)
+            ct += MIN(room - 1, rmax);
+    }
+    return ct;
+}
+
+critical_odds_t critical_norm_odds(int weight, int plus, s16b meichuu, int mode, int hand)
+{
+    critical_odds_t odds = {0};
+    int             i, roll, quality, extra, which;
+    s32b            total, below = 0, tot = 0;
+
+    i = _critical_norm_chance(&weight, plus, meichuu, hand, &roll, &quality);
+    _critical_norm_extra(mode, &extra);
+
+    if (_always_crit(mode))
+    {
+        odds.roll = roll;
+        odds.chance = roll;
+    }
+    else
+    {
+        odds.roll = roll;
+        odds.chance = _clamp_chance(i, roll);
+    }
+
+    /* k = weight + randint1(quality) [+ randint1(extra)] */
+    total = quality * MAX(1, extra);
+    if (total <= 0) return odds;
+    for (which = 0; which < _NORM_CRIT_MAX; which++)
+    {
+        s32b ct;
+        if (which < _NORM_CRIT_MAX - 1)
         {
-            result.desc = "It was a <color:v>*GREAT*</color> hit!";
-            result.mul = 350;
+            s32b cum = _count_below(weight, quality, extra, _norm_crits[which].k);
+            ct = cum - below;
+            below = cum;
         }
         else
-        {
-            result.desc = "It was a <color:v>*SUPERB*</color> hit!";
-            result.mul = 400;
-        }
+            ct = total - below;
+        tot += ct * _critical_norm_mul(which);
     }
+    odds.mul = (tot + total / 2) / total;
 
-    /* Golem criticals are too strong */
-    if (prace_is_(RACE_MON_GOLEM) && (result.mul > 100))
-    {
-        result.mul -= ((result.mul - 100) / 3);
-    }
+    return odds;
+}
 
-    return result;
+/* Average multiplier per blow, crit or not (scaled by 100) */
+int critical_avg_mul(critical_odds_t odds)
+{
+    if (odds.roll <= 0 || odds.chance <= 0) return 100;
+    return 100 + ((odds.mul - 100) * odds.chance + odds.roll / 2) / odds.roll;
+}
+
+/* Chance of a critical (scaled by 1000) */
+int critical_pct(critical_odds_t odds)
+{
+    if (odds.roll <= 0 || odds.chance <= 0) return 0;
+    return (odds.chance * 1000 + odds.roll / 2) / odds.roll;
 }
 
 /**********************************************************************
@@ -1572,69 +1671,26 @@ void display_weapon_info(doc_ptr doc, int hand)
     if (!have_flag(flgs, OF_BRAND_ORDER)
         && weaponmaster_get_toggle() != TOGGLE_ORDER_BLADE)
     {
-/*        const int attempts = 10 * 1000;*/
-        int crits = 0;
-        /* Compute average effects of criticals by sampling
-         * Try to get full sample if possible */
-        _initialize_crit_loop(display_weapon_mode);
-        while (1)
+        critical_odds_t odds = critical_norm_odds(o_ptr->weight, to_h, p_ptr->weapon_info[hand].to_h, display_weapon_mode, hand);
+
+        /* Fake math for the human crit-limiting mut. We could use
+         * real math if we were willing to use non-integers, but we can
+         * get close enough using integers that rounding errors already
+         * present in any case are larger than the math errors */
+        if ((mut_present(MUT_HUMAN_STR)) && (num_blow > 100) && (odds.chance > 0))
         {
-            critical_t tmp = critical_norm(o_ptr->weight, to_h, p_ptr->weapon_info[hand].to_h, display_weapon_mode, hand);
-            if (tmp.desc)
+            /* Store probabilities in parts per 10000 */
+            s32b orig_crit_prob = (odds.chance * 10000 + (odds.roll / 2)) / odds.roll;
+            s32b crit_round_prob = 10000 - _fake_fractional_power(10000 - orig_crit_prob, num_blow);
+            s32b real_crit_prob = (crit_round_prob * 100 + (num_blow / 2)) / num_blow;
+            if (real_crit_prob < orig_crit_prob)
             {
-                crit.mul += tmp.mul;
-                crit.to_d += tmp.to_d;
-                crits++;
-            }
-            else if (!_critical_loop) break;
-            else crit.mul += 100;
-        }
-        if ((!_critical_attempts) || (((_critical_roll < 1) || (_critical_comp < 1)) && (!_always_crit(display_weapon_mode))))
-            /* Something has gone horribly wrong, or the numbers are negative/zero... */
-        {
-            crit.mul = 100;
-            crit.to_d = 0;
-            crit_pct = 0;
-        }
-        else /* Evil voodoo */
-        {
-            /* Fake math for the human crit-limiting mut. (All the other
-             * math here is real, just incredibly ugly...) We could use
-             * real math if we were willing to use non-integers, but we can
-             * get close enough using integers that rounding errors already
-             * present in any case are larger than the math errors */
-            if ((mut_present(MUT_HUMAN_STR)) && (num_blow > 100) && (crits))
-            {
-                /* Store probabilities in parts per 10000 */
-                s32b orig_crit_prob = (_critical_comp * 10000 + (_critical_roll / 2)) / _critical_roll;
-                s32b crit_round_prob = 10000 - _fake_fractional_power(10000 - orig_crit_prob, num_blow);
-                s32b real_crit_prob = (crit_round_prob * 100 + (num_blow / 2)) / num_blow;
-                if (real_crit_prob < orig_crit_prob)
-                {
-                    _critical_comp = (_critical_comp * real_crit_prob * 2) / orig_crit_prob + 1;
-                    _critical_roll *= 2;
-                }
-            }
-            if (_critical_roll != _critical_comp)
-            {
-                crit.mul -= (_critical_attempts * 100);
-                if (((0x7FFFFFFF - (_critical_roll / 2)) / _critical_comp) < crit.mul)
-                {
-                    crit.mul = (crit.mul * _critical_comp + (_critical_roll / 2)) / _critical_roll;
-                }
-                else crit.mul = (crit.mul + (_critical_roll / 2)) / _critical_roll * _critical_comp;
-                crit.mul += (_critical_attempts * 201) / 2;
-                crit.mul /= _critical_attempts;
-                crit.to_d = (crit.to_d * 100 + (_critical_roll / 2)) / _critical_roll * _critical_comp / _critical_attempts;
-                crit_pct = (_critical_comp * 1000 + (_critical_roll / 2)) / _critical_roll;
-            }
-            else
-            {
-                crit.mul = (crit.mul + (_critical_attempts / 2)) / _critical_attempts;
-                crit.to_d = (crit.to_d * 100 + (_critical_attempts / 2)) / _critical_attempts;
-                crit_pct = 1000;
+                odds.chance = (odds.chance * real_crit_prob * 2) / orig_crit_prob + 1;
+                odds.roll *= 2;
             }
         }
+        crit.mul = critical_avg_mul(odds);
+        crit_pct = critical_pct(odds);
     }
     else
         crit.mul = 100;
@@ -1883,43 +1939,7 @@ void display_innate_attack_info(doc_ptr doc, int which)
     if (!(a->flags & (INNATE_NO_DAM | INNATE_NO_CRIT)))
     {
         critical_t crit = {0};
-        _initialize_crit_loop(0);
-        while (1)
-        {
-            critical_t tmp = critical_norm(a->weight, to_h, 0, 0, HAND_NONE);
-            if (tmp.desc)
-            {
-                crit.mul += tmp.mul;
-                crit.to_d += tmp.to_d;
-            }
-            else if (!_critical_loop) break;
-            else crit.mul += 100;
-        }
-        if ((!_critical_attempts) || (_critical_roll < 1) || (_critical_comp < 1)) /* Something has gone horribly wrong... */
-        {
-            crit.mul = 100;
-            crit.to_d = 0;
-        }
-        else /* Evil voodoo */
-        {
-            if (_critical_roll != _critical_comp)
-            {
-                crit.mul -= (_critical_attempts * 100);
-                if (((0x7FFFFFFF - (_critical_roll / 2)) / _critical_comp) < crit.mul)
-                {
-                    crit.mul = (crit.mul * _critical_comp + (_critical_roll / 2)) / _critical_roll;
-                }
-                else crit.mul = (crit.mul + (_critical_roll / 2)) / _critical_roll * _critical_comp;
-                crit.mul += (_critical_attempts * 201) / 2;
-                crit.mul /= _critical_attempts;
-                crit.to_d = (crit.to_d * 100 + (_critical_roll / 2)) / _critical_roll * _critical_comp / _critical_attempts;
-            }
-            else
-            {
-                crit.mul = (crit.mul + (_critical_attempts / 2)) / _critical_attempts;
-                crit.to_d = (crit.to_d * 100 + (_critical_attempts / 2)) / _critical_attempts;
-            }
-        }
+        crit.mul = critical_avg_mul(critical_norm_odds(a->weight, to_h, 0, 0, HAND_NONE));
         if (crit.to_d)
             doc_printf(cols[0], " %-7.7s: %d.%02dx + %d.%02d\n", "Crits", crit.mul/100, crit.mul%100, crit.to_d/100, crit.to_d%100);
         else
@@ -2186,24 +2206,9 @@ static void _shooter_info_aux(doc_ptr doc, object_type *bow, object_type *arrow,
         ds += 2;
 
     {
-        const int ct = 10 * 1000;
-        int i, crits = 0;
-        /* Compute Average Effects of Criticals by sampling */
-        for (i = 0; i < ct; i++)
-        {
-            critical_t tmp = critical_shot(arrow->weight, arrow->to_h);
-            if (tmp.desc)
-            {
-                crit.mul += tmp.mul;
-                crit.to_d += tmp.to_d;
-                crits++;
-            }
-            else
-                crit.mul += 100;
-        }
-        crit.mul = crit.mul / ct;
-        crit.to_d = crit.to_d * 100 / ct;
-        crit_pct = crits * 1000 / ct;
+        critical_odds_t odds = critical_shot_odds(arrow->weight, arrow->to_h);
+        crit.mul = critical_avg_mul(odds);
+        crit_pct = critical_pct(odds);
     }
 
     /* First Column */
@@ -1643,8 +1643,7 @@ void cornucopia_load(savefile_ptr file)
         _marker = savefile_read_s16b(file);
         if (_marker == 0x5FF9)
         {
-            obj_ptr obj = malloc(sizeof(object_type));
-            object_wipe(obj);
+            obj_ptr obj = obj_alloc();
             obj_load(obj, file);
             _my_policies[i].o_ptr = obj;
         }
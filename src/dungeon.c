@@ -1643,6 +1643,24 @@ static void process_world_aux_hp_and_sp(void)
     }
 }
 
+/*
+ * Count down a timed effect whose set_*() routine does nothing but store
+ * the value and flag PR_STATUS while the effect stays active: the status
+ * bar only shows which effects are up, not for how long. So we just
+ * decrement in place and let the set_*() routine handle expiry (message,
+ * PU_BONUS and so on). Effects that do more as they count down (saving
+ * throws, unwell thresholds, no_air on the surface, hero and shero for
+ * alchemists, resistances some races force on) still call their
+ * routines every turn.
+ */
+static void _timeout_tick(s16b *timer, bool (*set)(int v, bool do_dec))
+{
+    if (*timer > 1 && !p_ptr->is_dead)
+        (*timer)--;
+    else
+        set(*timer - 1, TRUE);
+}
+
 /*
  * Handle timeout every 10 game turns
  */
@@ -1678,18 +1696,18 @@ static void process_world_aux_timeout(void)
     /* Times see-invisible */
     if (p_ptr->tim_invis)
     {
-        (void)set_tim_invis(p_ptr->tim_invis - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_invis, set_tim_invis);
     }
 
     /* Timed esp */
     if (p_ptr->tim_esp)
     {
-        (void)set_tim_esp(p_ptr->tim_esp - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_esp, set_tim_esp);
     }
 
     if (p_ptr->tim_esp_magical)
     {
-        (void)set_tim_esp_magical(p_ptr->tim_esp_magical - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_esp_magical, set_tim_esp_magical);
     }
 
     /* Timed temporary elemental brands. -LM- */
@@ -1713,79 +1731,79 @@ static void process_world_aux_timeout(void)
     /* Timed infra-vision */
     if (p_ptr->tim_infra)
     {
-        (void)set_tim_infra(p_ptr->tim_infra - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_infra, set_tim_infra);
     }
 
     /* Timed poetry */
     if (p_ptr->tim_poet)
     {
-        (void)set_tim_poet(p_ptr->tim_poet - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_poet, set_tim_poet);
     }
 
     /* Timed poetry */
     if (p_ptr->tim_understanding)
     {
-        (void)set_tim_understanding(p_ptr->tim_understanding - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_understanding, set_tim_understanding);
     }
 
     /* Timed stealth */
     if (p_ptr->tim_stealth)
     {
-        (void)set_tim_stealth(p_ptr->tim_stealth - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_stealth, set_tim_stealth);
     }
 
     /* Timed levitation */
     if (p_ptr->tim_levitation)
     {
-        (void)set_tim_levitation(p_ptr->tim_levitation - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_levitation, set_tim_levitation);
     }
 
     /* Timed sh_touki */
     if (p_ptr->tim_sh_touki)
     {
-        (void)set_tim_sh_touki(p_ptr->tim_sh_touki - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sh_touki, set_tim_sh_touki);
     }
 
     /* Timed sh_fire */
     if (p_ptr->tim_sh_fire)
     {
-        (void)set_tim_sh_fire(p_ptr->tim_sh_fire - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sh_fire, set_tim_sh_fire);
     }
 
     if (p_ptr->tim_sh_elements)
-        set_tim_sh_elements(p_ptr->tim_sh_elements - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sh_elements, set_tim_sh_elements);
 
     if (p_ptr->tim_sh_shards)
-        set_tim_sh_shards(p_ptr->tim_sh_shards - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sh_shards, set_tim_sh_shards);
 
     if (p_ptr->tim_sh_domination)
-        set_tim_sh_domination(p_ptr->tim_sh_domination - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sh_domination, set_tim_sh_domination);
 
     if (p_ptr->tim_weaponmastery)
-        set_tim_weaponmastery(p_ptr->tim_weaponmastery - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_weaponmastery, set_tim_weaponmastery);
 
     /* Timed sh_holy */
     if (p_ptr->tim_sh_holy)
     {
-        (void)set_tim_sh_holy(p_ptr->tim_sh_holy - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sh_holy, set_tim_sh_holy);
     }
 
     /* Timed eyeeye */
     if (p_ptr->tim_eyeeye)
     {
-        (void)set_tim_eyeeye(p_ptr->tim_eyeeye - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_eyeeye, set_tim_eyeeye);
     }
 
     /* Timed resist-magic */
     if (p_ptr->resist_magic)
     {
-        (void)set_resist_magic(p_ptr->resist_magic - 1, TRUE);
+        _timeout_tick(&p_ptr->resist_magic, set_resist_magic);
     }
 
     /* Timed regeneration */
     if (p_ptr->tim_regen)
     {
-        (void)set_tim_regen(p_ptr->tim_regen - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_regen, set_tim_regen);
     }
 
     /* Timed no-air */
@@ -1797,39 +1815,39 @@ static void process_world_aux_timeout(void)
     /* Timed resist nether */
     if (p_ptr->tim_res_nether)
     {
-        (void)set_tim_res_nether(p_ptr->tim_res_nether - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_res_nether, set_tim_res_nether);
     }
 
     /* Timed resist time */
     if (p_ptr->tim_res_time)
     {
-        (void)set_tim_res_time(p_ptr->tim_res_time - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_res_time, set_tim_res_time);
     }
 
     if (p_ptr->tim_res_disenchantment)
-        (void)set_tim_res_disenchantment(p_ptr->tim_res_disenchantment - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_res_disenchantment, set_tim_res_disenchantment);
 
     /* Timed reflect */
     if (p_ptr->tim_reflect)
     {
-        (void)set_tim_reflect(p_ptr->tim_reflect - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_reflect, set_tim_reflect);
     }
 
     /* Multi-shadow */
     if (p_ptr->multishadow)
     {
-        (void)set_multishadow(p_ptr->multishadow - 1, TRUE);
+        _timeout_tick(&p_ptr->multishadow, set_multishadow);
     }
 
     /* Timed Robe of dust */
     if (p_ptr->dustrobe)
     {
-        (void)set_dustrobe(p_ptr->dustrobe - 1, TRUE);
+        _timeout_tick(&p_ptr->dustrobe, set_dustrobe);
     }
 
     if (p_ptr->kabenuke)
     {
-        (void)set_kabenuke(p_ptr->kabenuke - 1, TRUE);
+        _timeout_tick(&p_ptr->kabenuke, set_kabenuke);
     }
 
     /* Confusion */
@@ -1842,7 +1860,7 @@ static void process_world_aux_timeout(void)
     /* Fast */
     if (p_ptr->fast)
     {
-        (void)set_fast(p_ptr->fast - 1, TRUE);
+        _timeout_tick(&p_ptr->fast, set_fast);
     }
 
     /* Slow: Note FA helps recovery, but this aid should be
@@ -1877,19 +1895,19 @@ static void process_world_aux_timeout(void)
     /* Protection from evil */
     if (p_ptr->protevil)
     {
-        (void)set_protevil(p_ptr->protevil - 1, TRUE);
+        _timeout_tick(&p_ptr->protevil, set_protevil);
     }
 
     /* Invulnerability */
     if (p_ptr->invuln)
     {
-        (void)set_invuln(p_ptr->invuln - 1, TRUE);
+        _timeout_tick(&p_ptr->invuln, set_invuln);
     }
 
     /* Wraith form */
     if (p_ptr->wraith_form)
     {
-        (void)set_wraith_form(p_ptr->wraith_form - 1, TRUE);
+        _timeout_tick(&p_ptr->wraith_form, set_wraith_form);
     }
 
     /* Heroism */
@@ -1907,43 +1925,43 @@ static void process_world_aux_timeout(void)
     /* Blessed */
     if (p_ptr->blessed)
     {
-        (void)set_blessed(p_ptr->blessed - 1, TRUE);
+        _timeout_tick(&p_ptr->blessed, set_blessed);
     }
 
     /* Shield */
     if (p_ptr->shield)
     {
-        (void)set_shield(p_ptr->shield - 1, TRUE);
+        _timeout_tick(&p_ptr->shield, set_shield);
     }
 
     /* Tsubureru */
     if (p_ptr->tsubureru)
     {
-        (void)set_tsubureru(p_ptr->tsubureru - 1, TRUE);
+        _timeout_tick(&p_ptr->tsubureru, set_tsubureru);
     }
 
     /* Magicdef */
     if (p_ptr->magicdef)
     {
-        (void)set_magicdef(p_ptr->magicdef - 1, TRUE);
+        _timeout_tick(&p_ptr->magicdef, set_magicdef);
     }
 
     /* Tsuyoshi */
     if (p_ptr->tsuyoshi)
     {
-        (void)set_tsuyoshi(p_ptr->tsuyoshi - 1, TRUE);
+        _timeout_tick(&p_ptr->tsuyoshi, set_tsuyoshi);
     }
 
     /* Oppose Acid */
     if (p_ptr->oppose_acid)
     {
-        (void)set_oppose_acid(p_ptr->oppose_acid - 1, TRUE);
+        _timeout_tick(&p_ptr->oppose_acid, set_oppose_acid);
     }
 
     /* Oppose Lightning */
     if (p_ptr->oppose_elec)
     {
-        (void)set_oppose_elec(p_ptr->oppose_elec - 1, TRUE);
+        _timeout_tick(&p_ptr->oppose_elec, set_oppose_elec);
     }
 
     /* Oppose Fire */
@@ -1955,7 +1973,7 @@ static void process_world_aux_timeout(void)
     /* Oppose Cold */
     if (p_ptr->oppose_cold)
     {
-        (void)set_oppose_cold(p_ptr->oppose_cold - 1, TRUE);
+        _timeout_tick(&p_ptr->oppose_cold, set_oppose_cold);
     }
 
     /* Oppose Poison */
@@ -1967,145 +1985,145 @@ static void process_world_aux_timeout(void)
     /* Spin */
     if (p_ptr->spin)
     {
-        (void)set_spin(p_ptr->spin - 1, TRUE);
+        _timeout_tick(&p_ptr->spin, set_spin);
     }
 
     if (p_ptr->ult_res)
     {
-        (void)set_ultimate_res(p_ptr->ult_res - 1, TRUE);
+        _timeout_tick(&p_ptr->ult_res, set_ultimate_res);
     }
 
     if (p_ptr->tim_spurt)
     {
-        (void)set_tim_spurt(p_ptr->tim_spurt - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_spurt, set_tim_spurt);
     }
 
     if (p_ptr->tim_blood_shield)
     {
-        (void)set_tim_blood_shield(p_ptr->tim_blood_shield - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_blood_shield, set_tim_blood_shield);
     }
 
     if (p_ptr->tim_blood_rite)
     {
-        (void)set_tim_blood_rite(p_ptr->tim_blood_rite - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_blood_rite, set_tim_blood_rite);
     }
 
     if (p_ptr->tim_blood_seek)
     {
-        (void)set_tim_blood_seek(p_ptr->tim_blood_seek - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_blood_seek, set_tim_blood_seek);
     }
 
     if (p_ptr->tim_blood_sight)
     {
-        (void)set_tim_blood_sight(p_ptr->tim_blood_sight - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_blood_sight, set_tim_blood_sight);
     }
 
     if (p_ptr->tim_blood_feast)
     {
-        (void)set_tim_blood_feast(p_ptr->tim_blood_feast - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_blood_feast, set_tim_blood_feast);
     }
 
     if (p_ptr->tim_blood_revenge)
     {
-        (void)set_tim_blood_revenge(p_ptr->tim_blood_revenge - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_blood_revenge, set_tim_blood_revenge);
     }
 
     if (p_ptr->tim_superstealth)
-        set_tim_superstealth(p_ptr->tim_superstealth - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_superstealth, set_tim_superstealth);
 
     if (p_ptr->tim_force)
     {
-        set_tim_force(p_ptr->tim_force - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_force, set_tim_force);
     }
 
     if (p_ptr->tim_building_up)
     {
-        set_tim_building_up(p_ptr->tim_building_up - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_building_up, set_tim_building_up);
     }
 
     if (p_ptr->tim_vicious_strike)
     {
-        set_tim_vicious_strike(p_ptr->tim_vicious_strike - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_vicious_strike, set_tim_vicious_strike);
     }
 
     if (p_ptr->tim_enlarge_weapon)
     {
-        set_tim_enlarge_weapon(p_ptr->tim_enlarge_weapon - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_enlarge_weapon, set_tim_enlarge_weapon);
     }
 
     if (p_ptr->tim_field)
     {
-        set_tim_field(p_ptr->tim_field - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_field, set_tim_field);
     }
 
     if (p_ptr->tim_spell_reaction)
-        set_tim_spell_reaction(p_ptr->tim_spell_reaction - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_spell_reaction, set_tim_spell_reaction);
 
     if (p_ptr->tim_resist_curses)
-        set_tim_resist_curses(p_ptr->tim_resist_curses - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_resist_curses, set_tim_resist_curses);
 
     if (p_ptr->tim_armor_of_fury)
-        set_tim_armor_of_fury(p_ptr->tim_armor_of_fury - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_armor_of_fury, set_tim_armor_of_fury);
 
     if (p_ptr->tim_spell_turning)
-        set_tim_spell_turning(p_ptr->tim_spell_turning - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_spell_turning, set_tim_spell_turning);
 
     if (p_ptr->tim_sustain_str)
-        set_tim_sustain_str(p_ptr->tim_sustain_str - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sustain_str, set_tim_sustain_str);
 
     if (p_ptr->tim_sustain_int)
-        set_tim_sustain_int(p_ptr->tim_sustain_int - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sustain_int, set_tim_sustain_int);
 
     if (p_ptr->tim_sustain_wis)
-        set_tim_sustain_wis(p_ptr->tim_sustain_wis - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sustain_wis, set_tim_sustain_wis);
 
     if (p_ptr->tim_sustain_dex)
-        set_tim_sustain_dex(p_ptr->tim_sustain_dex - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sustain_dex, set_tim_sustain_dex);
 
     if (p_ptr->tim_sustain_con)
-        set_tim_sustain_con(p_ptr->tim_sustain_con - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sustain_con, set_tim_sustain_con);
 
     if (p_ptr->tim_sustain_chr)
-        set_tim_sustain_chr(p_ptr->tim_sustain_chr - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sustain_chr, set_tim_sustain_chr);
 
     if (p_ptr->tim_hold_life)
-        set_tim_hold_life(p_ptr->tim_hold_life - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_hold_life, set_tim_hold_life);
 
     if (p_ptr->tim_transcendence)
-        set_tim_transcendence(p_ptr->tim_transcendence - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_transcendence, set_tim_transcendence);
 
     if (p_ptr->tim_quick_walk)
-        set_tim_quick_walk(p_ptr->tim_quick_walk - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_quick_walk, set_tim_quick_walk);
 
     if (p_ptr->tim_inven_prot)
-        set_tim_inven_prot(p_ptr->tim_inven_prot - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_inven_prot, set_tim_inven_prot);
 
     if (p_ptr->tim_inven_prot2)
-        set_tim_inven_prot2(p_ptr->tim_inven_prot2 - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_inven_prot2, set_tim_inven_prot2);
 
     if (p_ptr->tim_device_power)
-        set_tim_device_power(p_ptr->tim_device_power - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_device_power, set_tim_device_power);
 
     if (p_ptr->tim_sh_time)
-        set_tim_sh_time(p_ptr->tim_sh_time - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_sh_time, set_tim_sh_time);
 
     if (p_ptr->tim_foresight)
-        set_tim_foresight(p_ptr->tim_foresight - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_foresight, set_tim_foresight);
 
     if (p_ptr->tim_dark_stalker)
-        set_tim_dark_stalker(p_ptr->tim_dark_stalker - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_dark_stalker, set_tim_dark_stalker);
 
     if (p_ptr->tim_nimble_dodge)
-        set_tim_nimble_dodge(p_ptr->tim_nimble_dodge - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_nimble_dodge, set_tim_nimble_dodge);
 
     if (p_ptr->tim_stealthy_snipe)
-        set_tim_stealthy_snipe(p_ptr->tim_stealthy_snipe - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_stealthy_snipe, set_tim_stealthy_snipe);
 
     if (p_ptr->tim_killing_spree)
-        set_tim_killing_spree(p_ptr->tim_killing_spree - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_killing_spree, set_tim_killing_spree);
 
     if (p_ptr->tim_slay_sentient)
-        set_tim_slay_sentient(p_ptr->tim_slay_sentient - 1, TRUE);
+        _timeout_tick(&p_ptr->tim_slay_sentient, set_tim_slay_sentient);
 
     wild_decrement_counters();
 
@@ -3115,6 +3133,10 @@ static void process_world(void)
         msg_print("You hear noise.");
     }
 
+    /*** Restock the town's shops a little at a time ***/
+    if (py_in_town() && !p_ptr->wild_mode)
+        towns_maintain_shops();
+
     /*** Handle the wilderness/town (sunshine) ***/
 
     /* While in town/wilderness */
@@ -4866,6 +4888,7 @@ static void process_player(void)
 
         /* Handle "p_ptr->update" and "p_ptr->redraw" and "p_ptr->window" */
         handle_stuff();
+        window_refresh();
 
         /* Place the cursor on the player */
         move_cursor_relative(py, px);
@@ -5730,6 +5753,7 @@ void get_mystery_flags(void)
     {
         d_ptr->flags1 |= DF1_ALL_SHAFTS;
     }
+    mon_race_props_invalidate();
 }
 
 void design_mystery_cave(void)
@@ -6001,6 +6025,11 @@ void determine_today_mon(bool conv_old)
 }
 
 
+#ifdef ALLOW_SPOILERS
+static cptr _spoilers_need_char =
+    "The -s option needs an existing character (use -u<who> with a savefile).";
+#endif
+
 /*
  * Actually play a game
  *
@@ -6039,7 +6068,7 @@ void play_game(bool new_game)
 
     /* The Windows port blocks until the user chooses a menu for a New game, or
        to load an existing game. Thus, it will display its own start screen ... */
-    if (strcmp(ANGBAND_SYS, "win") != 0)
+    if (strcmp(ANGBAND_SYS, "win") != 0 && !arg_spoilers)
     {
         /* On X11, you need to flush() before Term->hgt is accurate! */
         Term_flush();
@@ -6049,6 +6078,16 @@ void play_game(bool new_game)
     /* Hack -- turn off the cursor */
     (void)Term_set_cursor(0);
 
+#ifdef ALLOW_SPOILERS
+    /* Hack -- Don't stop at the "Savefile does not exist" prompt either */
+    if (arg_spoilers && (new_game || !savefile[0]))
+        quit(_spoilers_need_char);
+#if !defined(MACINTOSH) && !defined(WINDOWS) && !defined(VM)
+    if (arg_spoilers && access(savefile, 0) < 0)
+        quit(_spoilers_need_char);
+#endif
+#endif
+
     /* Attempt to load */
     if (!load_player())
     {
@@ -6090,6 +6129,12 @@ void play_game(bool new_game)
         process_player_name(FALSE);
     }
 
+#ifdef ALLOW_SPOILERS
+    /* Hack -- The spoilers need a character, and -s must never block at birth */
+    if (arg_spoilers && new_game)
+        quit(_spoilers_need_char);
+#endif
+
     /* Init the RNG */
     if (Rand_quick)
     {
@@ -6222,6 +6267,16 @@ void play_game(bool new_game)
     /* Flavor the objects */
     flavor_init();
 
+#ifdef ALLOW_SPOILERS
+    /* Hack -- Write the spoilers for this character and quit (-s) */
+    if (arg_spoilers)
+    {
+        generate_spoilers();
+        generate_wizard_spoilers();
+        quit(NULL);
+    }
+#endif
+
     /* Flush the message */
     Term_fresh();
 
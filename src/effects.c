@@ -345,6 +345,7 @@ bool m_inc_minislow(monster_type *m_ptr, int lisays)
     byte vanha = m_ptr->minislow;
     bool tulos;
     m_ptr->minislow = _inc_minislow(m_ptr->minislow, lisays);
+    mon_hot_sync(m_ptr->id);
     tulos = (m_ptr->minislow != vanha);
 
     if (!tulos) return FALSE;
@@ -124,6 +124,7 @@ extern u16b sf_lives;
 extern u16b sf_saves;
 extern bool arg_fiddle;
 extern bool arg_wizard;
+extern bool arg_spoilers;
 extern bool arg_sound;
 extern byte arg_graphics;
 extern bool arg_monochrome;
@@ -512,6 +513,8 @@ extern s16b max_floor_id;
 extern u32b saved_floor_file_sign;
 extern object_type *o_list;
 extern monster_type *m_list;
+extern mon_hot_t *m_hot;
+extern u32b *m_hot_active;
 
 extern pack_info_t *pack_info_list;
 extern s16b max_pack_info_idx;
@@ -776,6 +779,7 @@ extern void display_map(int *cy, int *cx);
 extern void do_cmd_view_map(void);
 extern void forget_lite(void);
 extern void update_lite(void);
+extern void invalidate_view(void);
 extern void forget_view(void);
 extern void update_view(void);
 extern void update_mon_lite(void);
@@ -825,6 +829,20 @@ extern critical_t critical_shot(int weight, int plus);
 extern critical_t critical_norm(int weight, int plus, s16b meichuu, int mode, int hand);
 extern critical_t critical_throw(int weight, int plus);
 
+/* Closed form odds of the above for display: a critical happens when
+ * randint1(roll) <= chance, and then multiplies damage by mul (scaled by 100)
+ * on average. */
+typedef struct critical_odds_s {
+    int chance;
+    int roll;
+    int mul;
+} critical_odds_t;
+extern critical_odds_t critical_shot_odds(int weight, int plus);
+extern critical_odds_t critical_norm_odds(int weight, int plus, s16b meichuu, int mode, int hand);
+extern critical_odds_t critical_throw_odds(int weight, int plus);
+extern int critical_avg_mul(critical_odds_t odds); /* per blow, crit or not (scaled by 100) */
+extern int critical_pct(critical_odds_t odds);     /* scaled by 1000 */
+
 extern s16b tot_dam_aux(object_type *o_ptr, int tdam, monster_type *m_ptr, s16b hand, int mode, bool thrown);
 extern void search(void);
 extern bool no_melee_check(void);
@@ -1137,6 +1155,7 @@ extern char tval_to_attr_char(int tval);
 extern char attr_to_attr_char(byte a);
 extern char *object_desc_kosuu(char *t, object_type *o_ptr);
 extern void object_desc(char *buf, object_type *o_ptr, u32b mode);
+extern void object_desc_invalidate(void);
 extern int resist_opposite_flag(int i);
 
 /* floors.c */
@@ -1164,6 +1183,8 @@ extern void drop_here(object_type *j_ptr, int y, int x);
 extern errr process_dungeon_file(cptr name, int options); /* XXX */
 typedef errr (*parser_f)(char *line, int options);
 extern errr parse_edit_file(cptr name, parser_f f, int options);
+extern vec_ptr load_edit_file(cptr name);
+extern errr parse_edit_lines(cptr name, vec_ptr lines, parser_f f, int options);
 extern errr init_v_info(int options);
 extern int parse_lookup_monster(cptr name, int options);
 extern int parse_lookup_artifact(cptr name, int options);
@@ -1282,9 +1303,12 @@ extern void delete_monster_idx(int i);
 extern void delete_monster(int y, int x);
 extern void compact_monsters(int size);
 extern void wipe_m_list(void);
+extern void mon_hot_sync(int m_idx);
+extern int mon_hot_prev_active(int m_idx);
 extern bool mon_attack_mon(int m_idx, int t_idx);
 
 extern bool mon_is_type(int r_idx, int type); /* Uses the various SUMMON_* constants */
+extern void mon_race_props_invalidate(void);
 extern int mon_available_num(monster_race *r_ptr);
 
 extern s16b pack_info_pop(void);
@@ -1852,6 +1876,7 @@ extern void notice_stuff(void);
 extern void update_stuff(void);
 extern void redraw_stuff(void);
 extern void window_stuff(void);
+extern void window_refresh(void);
 extern void handle_stuff(void);
 extern bool heavy_armor(void);
 extern int  py_prorata_level(int amt);
@@ -2342,6 +2367,7 @@ extern vec_ptr stats_egos(void);
 extern void stats_add_ego(object_type *o_ptr);
 #ifdef ALLOW_SPOILERS
 extern void do_cmd_spoilers(void);
+extern void generate_wizard_spoilers(void);
 #endif
 
 
@@ -2995,6 +3021,9 @@ extern cptr weaponmaster_speciality_name(int psubclass);
 
 /* spoilers.c */
 extern void generate_spoilers(void);
+extern FILE *spoiler_fopen(cptr path);
+extern bool spoiler_fclose(FILE *fp, cptr path);
+extern void spoiler_fabort(FILE *fp, cptr path);
 
 
 /* wild_talent.c */
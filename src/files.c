@@ -1849,8 +1849,9 @@ static errr file_character(cptr name, bool no_msgs)
         else if (cb > 4 && strcmp(name + cb - 4, ".htm") == 0)
             format = DOC_FORMAT_HTML;
 
+        doc_begin_stream(doc, fff, format);
         py_display_character_sheet(doc);
-        doc_write_file(doc, fff, format);
+        doc_end_stream(doc);
         doc_free(doc);
     }
 
@@ -299,6 +299,8 @@ void flavor_init(void)
         /* Check for "easily known" */
         k_ptr->easy_know = object_easy_know(i);
     }
+
+    object_desc_invalidate();
 }
 
 
@@ -958,6 +960,80 @@ char tval_to_attr_char(int tval)
     return attr_to_attr_char(tval_to_attr[tval % 128]);
 }
 
+/*
+ * Description cache. object_desc() is called for every inventory row,
+ * floor item, object list line and autopick match, usually on objects that
+ * have not changed since the last time they were described. Entries are
+ * validated against a full copy of the object (so any change to the object
+ * itself is a miss) and against a global generation that is bumped by
+ * object_desc_invalidate() whenever anything outside the object that the
+ * description depends on changes: flavor awareness, artifact/ego lore,
+ * player bonuses (damage dice, multipliers, device power) and options.
+ */
+#define _DESC_CACHE_SIZE 256
+
+typedef struct {
+    object_type obj;
+    u32b        mode;
+    u32b        gen;
+    char        desc[MAX_NLEN + 20]; /* Room for OD_COLOR_CODED markup */
+} _desc_cache_t;
+
+static _desc_cache_t _desc_cache[_DESC_CACHE_SIZE];
+static u32b          _desc_gen = 1;
+
+void object_desc_invalidate(void)
+{
+    _desc_gen++;
+}
+
+static _desc_cache_t *_desc_cache_slot(object_type *o_ptr, u32b mode)
+{
+    const byte *p = (const byte *)o_ptr;
+    u32b        h = 2166136261U ^ mode;
+    int         i;
+
+    for (i = 0; i < (int)sizeof(object_type); i++)
+        h = (h ^ p[i]) * 16777619U;
+
+    return &_desc_cache[h % _DESC_CACHE_SIZE];
+}
+
+static void _object_desc_aux(char *buf, object_type *o_ptr, u32b mode);
+
+void object_desc(char *buf, object_type *o_ptr, u32b mode)
+{
+    _desc_cache_t *entry;
+
+    /* Equipment descriptions depend on which slot the object actually sits
+       in (equip_which_hand() compares pointers), and statistics_hack changes
+       the output without changing the object. */
+    if (statistics_hack || o_ptr->loc.where == INV_EQUIP)
+    {
+        _object_desc_aux(buf, o_ptr, mode);
+        return;
+    }
+
+    entry = _desc_cache_slot(o_ptr, mode);
+    if ( entry->gen == _desc_gen
+      && entry->mode == mode
+      && memcmp(&entry->obj, o_ptr, sizeof(object_type)) == 0 )
+    {
+        strcpy(buf, entry->desc);
+        return;
+    }
+
+    _object_desc_aux(buf, o_ptr, mode);
+
+    if (strlen(buf) < sizeof(entry->desc))
+    {
+        entry->obj = *o_ptr;
+        entry->mode = mode;
+        entry->gen = _desc_gen;
+        strcpy(entry->desc, buf);
+    }
+}
+
 /*
  * Creates a description of the item "o_ptr", and stores it in "out_val".
  *
@@ -1005,7 +1081,7 @@ char tval_to_attr_char(int tval)
  *   OD_FORCE_FLAVOR     : Get un-shuffled flavor name
  *   OD_SINGULAR         : Pretend o_ptr->number == 1.
  */
-void object_desc(char *buf, object_type *o_ptr, u32b mode)
+static void _object_desc_aux(char *buf, object_type *o_ptr, u32b mode)
 {
     /* Extract object kind name */
     cptr            kindname = k_name + k_info[o_ptr->k_idx].name;
@@ -119,6 +119,58 @@ int dun_tun_jct;
  */
 dun_data *dun;
 
+/*
+ * Level generation runs as a fixed sequence of stages, and each stage
+ * draws from its own random stream: a copy of the level's stream jumped
+ * once per stage number, so the stages never overlap. Adding a room type
+ * (say) then no longer reshuffles the monsters and objects of an
+ * otherwise identical level, and a level can be rebuilt from its seed
+ * (see cheat_room). The gameplay RNG only pays for the one seed draw.
+ */
+enum {
+    _STAGE_SIZE,
+    _STAGE_LAYOUT,
+    _STAGE_CAVERNS,
+    _STAGE_ROOMS,
+    _STAGE_RIVERS,
+    _STAGE_TUNNELS,
+    _STAGE_STREAMERS,
+    _STAGE_PLAYER,
+    _STAGE_MONSTERS,
+    _STAGE_TRAPS,
+    _STAGE_OBJECTS,
+    _STAGE_GUARDIAN,
+};
+
+static rand_ctx_t   _level_rng;
+static rand_ctx_t   _stage_rng;
+static rand_ctx_ptr _saved_rng;
+
+static void _stage_begin(int stage)
+{
+    int i;
+
+    _stage_rng = _level_rng;
+    for (i = 0; i < stage; i++)
+        Rand_ctx_jump(&_stage_rng);
+}
+
+static void _level_seed_init(void)
+{
+    u32b seed = randint0(0x10000000);
+
+    Rand_ctx_seed(&_level_rng, seed);
+    _stage_rng = _level_rng;
+    _saved_rng = Rand_ctx_set(&_stage_rng);
+    if (cheat_room)
+        msg_format("<color:B>Level seed: <color:R>%07x</color>.</color>", seed);
+}
+
+static void _level_seed_done(void)
+{
+    Rand_ctx_set(_saved_rng);
+}
+
 /* Check if grid is wall-like */
 static bool _is_wally(int y, int x, bool check_bold)
 {
@@ -870,6 +922,8 @@ static bool cave_gen(void)
     /* Global data */
     dun = &dun_body;
 
+    _stage_begin(_STAGE_LAYOUT);
+
     dun->destroyed = FALSE;
     dun->empty_level = FALSE;
     dun->cavern = FALSE;
@@ -1065,8 +1119,11 @@ static bool cave_gen(void)
 
 
     /* Generate various caverns and lakes */
+    _stage_begin(_STAGE_CAVERNS);
     gen_caverns_and_lakes();
 
+    _stage_begin(_STAGE_ROOMS);
+
 
     /* Build maze */
     if (d_info[dungeon_type].flags1 & DF1_MAZE)
@@ -1105,6 +1162,7 @@ static bool cave_gen(void)
         if (dun->destroyed) destroy_level();
 
         /* Hack -- Add some rivers */
+        _stage_begin(_STAGE_RIVERS);
         if (one_in_((dungeon_type == DUNGEON_AUSSIE) ? 3 : 7) && (randint1(dun_level) > 5))
         {
             int feat1 = 0, feat2 = 0;
@@ -1152,6 +1210,7 @@ static bool cave_gen(void)
         }
 
         /* Hack -- Scramble the room order */
+        _stage_begin(_STAGE_TUNNELS);
         for (i = 0; i < dun->cent_n; i++)
         {
             int ty, tx;
@@ -1278,6 +1337,7 @@ static bool cave_gen(void)
         if (!alloc_stairs(feat_up_stair, rand_range(1, 2), 3)) return FALSE;
     }
 
+    _stage_begin(_STAGE_STREAMERS);
     if (!dun->laketype)
     {
         if (d_info[dungeon_type].stream2)
@@ -1314,14 +1374,19 @@ static bool cave_gen(void)
     }
 
     /* Determine the character location */
+    _stage_begin(_STAGE_PLAYER);
     if (!new_player_spot()) return FALSE;
 
+    _stage_begin(_STAGE_MONSTERS);
     _cave_gen_monsters();
+    _stage_begin(_STAGE_TRAPS);
     _cave_gen_traps();
 
+    _stage_begin(_STAGE_OBJECTS);
     _cave_gen_objects();
 
     /* Put the Guardian */
+    _stage_begin(_STAGE_GUARDIAN);
     if (!alloc_guardian(TRUE)) return FALSE;
 
     if (dun->empty_level && (!one_in_(DARK_EMPTY) || (randint1(100) > dun_level)) && !(d_info[dungeon_type].flags1 & DF1_DARKNESS))
@@ -1576,6 +1641,10 @@ static bool level_gen(cptr *why)
 {
     bool small = FALSE;
     bool coffee = FALSE;
+    bool okay;
+
+    _level_seed_init();
+    _stage_begin(_STAGE_SIZE);
 
     /* XXX Roll for a small level. Users should not be able to control
      * the level size at runtime. For example, I personally used to force
@@ -1785,7 +1854,9 @@ static bool level_gen(cptr *why)
     }
 
     /* Make a dungeon */
-    if (!cave_gen())
+    okay = cave_gen();
+    _level_seed_done();
+    if (!okay)
     {
         *why = "could not place player";
         return FALSE;
@@ -1419,6 +1419,36 @@ int charm_pow_modify(int dam, monster_type *mon)
     return dam;
 }
 
+/* The basic elements share a common pattern: immunity, resistance (1/3
+ * damage) and, for fire and cold, vulnerability (double damage). */
+#define _ELEM_QUIET_IMMUNE 0x01 /* no touch message or immunity note on aura/melee hits */
+typedef struct {
+    int  type;
+    u32b im_flag;   /* RFR_* */
+    u32b res_flag;  /* RFR_* */
+    u32b hurt_flag; /* RF3_* */
+    int  flags;
+    cptr touch_msg;
+} _elem_t, *_elem_ptr;
+
+/* Indexed by type - GF_ACID, like _gf_tbl[] */
+static _elem_t _elems[] = {
+    { GF_ACID, RFR_IM_ACID, RFR_RES_ACID, 0, 0, "%^s is <color:G>dissolved</color>!" },
+    { GF_ELEC, RFR_IM_ELEC, RFR_RES_ELEC, 0, 0, "%^s is <color:b>shocked</color>!" },
+    { GF_FIRE, RFR_IM_FIRE, RFR_RES_FIRE, RF3_HURT_FIRE, 0, "%^s is <color:r>burned</color>!" },
+    { GF_COLD, RFR_IM_COLD, RFR_RES_COLD, RF3_HURT_COLD, 0, "%^s is <color:W>frozen</color>!" },
+    { GF_POIS, RFR_IM_POIS, RFR_RES_POIS, 0, _ELEM_QUIET_IMMUNE, "%^s is <color:G>poisoned</color>!" },
+};
+
+static _elem_ptr _elem_lookup(int type)
+{
+    _elem_ptr elem;
+    assert(GF_ACID <= type && type < GF_ACID + (int)(sizeof(_elems)/sizeof(_elems[0])));
+    elem = &_elems[type - GF_ACID];
+    assert(elem->type == type);
+    return elem;
+}
+
 #define _BABBLE_HACK() \
             if (race->flagsr & RFR_RES_ALL) \
             { \
@@ -1598,104 +1628,39 @@ bool gf_affect_m(int who, mon_ptr mon, int type, int dam, int flags)
             dam = dam * MIN(66, race->spells->freq) / 100;
         break;
     case GF_ACID:
-        if (touch && seen_msg) msg_format("%^s is <color:G>dissolved</color>!", m_name);
-        if (seen) obvious = TRUE;
-        _BABBLE_HACK()
-        if (race->flagsr & RFR_IM_ACID)
-        {
-            note = " is immune.";
-            dam = 0;
-            mon_lore_r(mon, RFR_IM_ACID);
-        }
-        else if (race->flagsr & RFR_RES_ACID)
-        {
-            note = " resists.";
-            dam /= 3;
-            mon_lore_r(mon, RFR_RES_ACID);
-        }
-        break;
     case GF_ELEC:
-        if (touch && seen_msg) msg_format("%^s is <color:b>shocked</color>!", m_name);
-        if (seen) obvious = TRUE;
-        _BABBLE_HACK()
-        if (race->flagsr & RFR_IM_ELEC)
-        {
-            note = " is immune.";
-            dam = 0;
-            mon_lore_r(mon, RFR_IM_ELEC);
-        }
-        else if (race->flagsr & RFR_RES_ELEC)
-        {
-            note = " resists.";
-            dam /= 3;
-            mon_lore_r(mon, RFR_RES_ELEC);
-        }
-        break;
     case GF_FIRE:
-        if (touch && seen_msg) msg_format("%^s is <color:r>burned</color>!", m_name);
-        if (seen) obvious = TRUE;
-        _BABBLE_HACK()
-        if (race->flagsr & RFR_IM_FIRE)
-        {
-            note = " is immune.";
-            dam = 0;
-            mon_lore_r(mon, RFR_IM_FIRE);
-        }
-        else if (race->flagsr & RFR_RES_FIRE)
-        {
-            note = " resists.";
-            dam /= 3;
-            mon_lore_r(mon, RFR_RES_FIRE);
-        }
-        else if (race->flags3 & RF3_HURT_FIRE)
-        {
-            note = " is hit hard.";
-            dam *= 2;
-            mon_lore_3(mon, RF3_HURT_FIRE);
-        }
-        break;
     case GF_COLD:
-        if (touch && seen_msg) msg_format("%^s is <color:W>frozen</color>!", m_name);
+    case GF_POIS:
+    {
+        _elem_ptr elem = _elem_lookup(type);
+        bool      immune = BOOL(race->flagsr & elem->im_flag);
+
+        if (touch && seen_msg && !(immune && (elem->flags & _ELEM_QUIET_IMMUNE)))
+            msg_format(elem->touch_msg, m_name);
         if (seen) obvious = TRUE;
         _BABBLE_HACK()
-        if (race->flagsr & RFR_IM_COLD)
+        if (immune)
         {
-            note = " is immune.";
+            if (!touch || !(elem->flags & _ELEM_QUIET_IMMUNE))
+                note = " is immune.";
             dam = 0;
-            mon_lore_r(mon, RFR_IM_COLD);
+            mon_lore_r(mon, elem->im_flag);
         }
-        else if (race->flagsr & RFR_RES_COLD)
+        else if (race->flagsr & elem->res_flag)
         {
             note = " resists.";
             dam /= 3;
-            mon_lore_r(mon, RFR_RES_COLD);
+            mon_lore_r(mon, elem->res_flag);
         }
-        else if (race->flags3 & RF3_HURT_COLD)
+        else if (race->flags3 & elem->hurt_flag)
         {
             note = " is hit hard.";
             dam *= 2;
-            mon_lore_3(mon, RF3_HURT_COLD);
-        }
-        break;
-    case GF_POIS:
-        if (touch && seen_msg && !(race->flagsr & RFR_IM_POIS))
-            msg_format("%^s is <color:G>poisoned</color>!", m_name);
-        if (seen) obvious = TRUE;
-        _BABBLE_HACK()
-        if (race->flagsr & RFR_IM_POIS)
-        {
-            if (!touch)
-                note = " is immune.";
-            dam = 0;
-            mon_lore_r(mon, RFR_IM_POIS);
-        }
-        else if (race->flagsr & RFR_RES_POIS)
-        {
-            note = " resists.";
-            dam /= 3;
-            mon_lore_r(mon, RFR_RES_POIS);
+            mon_lore_3(mon, elem->hurt_flag);
         }
         break;
+    }
     case GF_NUKE:
         if (touch && seen_msg) msg_format("%^s is <color:G>irradiated</color>!", m_name);
         if (seen) obvious = TRUE;
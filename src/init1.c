@@ -2390,23 +2390,108 @@ errr parse_m_info(char *buf, header *head)
 
 
 /*
- * Grab one flag from a textual string
+ * Flag name lookup. The edit files name tens of thousands of flags and
+ * scanning the name tables with streq() took a good part of the parse, so
+ * each vocabulary is hashed on first use. A name maps to the first table
+ * (in the order given) that has it, exactly as the old scans did, and
+ * lookups return a (table, bit) code or -1.
  */
-static errr grab_one_flag(u32b *flags, cptr names[], cptr what)
+#define _FLAG_CODE(t, b) (((t) << 16) | (b))
+#define _FLAG_TABLE(c)   ((c) >> 16)
+#define _FLAG_BIT(c)     ((c) & 0xFFFF)
+
+static str_map_ptr _flag_map_alloc(cptr *tables[], const int counts[], int ct)
 {
-    int i;
+    str_map_ptr map = str_map_alloc(NULL);
+    int         t, b;
 
-    /* Check flags */
-    for (i = 0; i < 32; i++)
+    for (t = 0; t < ct; t++)
     {
-        if (streq(what, names[i]))
+        for (b = 0; b < counts[t]; b++)
         {
-            *flags |= (1L << i);
-            return 0;
+            if (!str_map_contains(map, tables[t][b]))
+                str_map_add(map, tables[t][b], (vptr)(intptr_t)(_FLAG_CODE(t, b) + 1));
         }
     }
+    return map;
+}
 
-    return -1;
+static int _flag_find(str_map_ptr map, cptr what)
+{
+    return (int)(intptr_t)str_map_find(map, what) - 1;
+}
+
+static int _feat_flag_find(cptr what)
+{
+    static str_map_ptr map = NULL;
+    if (!map)
+    {
+        cptr *tables[] = { f_info_flags };
+        int   counts[] = { FF_FLAG_MAX };
+        map = _flag_map_alloc(tables, counts, 1);
+    }
+    return _flag_find(map, what);
+}
+
+/* OF_* flags, then k_info_gen_flags */
+static int _object_flag_find(cptr what)
+{
+    static str_map_ptr map = NULL;
+    if (!map)
+    {
+        cptr *tables[] = { k_info_flags, k_info_gen_flags };
+        int   counts[] = { OF_COUNT, 32 };
+        map = _flag_map_alloc(tables, counts, 2);
+    }
+    return _flag_find(map, what);
+}
+
+/* r_info_flags1, 2, 3, 7, 8, 9 and r */
+static int _monster_flag_find(cptr what)
+{
+    static str_map_ptr map = NULL;
+    if (!map)
+    {
+        cptr *tables[] = { r_info_flags1, r_info_flags2, r_info_flags3, r_info_flags7,
+                           r_info_flags8, r_info_flags9, r_info_flagsr };
+        int   counts[] = { 32, 32, 32, 32, 32, 32, 32 };
+        map = _flag_map_alloc(tables, counts, 7);
+    }
+    return _flag_find(map, what);
+}
+
+static int _dungeon_flag_find(cptr what)
+{
+    static str_map_ptr map = NULL;
+    if (!map)
+    {
+        cptr *tables[] = { d_info_flags1 };
+        int   counts[] = { 32 };
+        map = _flag_map_alloc(tables, counts, 1);
+    }
+    return _flag_find(map, what);
+}
+
+static errr grab_one_object_flag(u32b *flags, u32b *gen_flags, cptr what)
+{
+    int code = _object_flag_find(what);
+
+    if (code < 0) return -1;
+    if (_FLAG_TABLE(code) == 0)
+        add_flag(flags, _FLAG_BIT(code));
+    else
+        *gen_flags |= (1L << _FLAG_BIT(code));
+    return 0;
+}
+
+/* flags[] in the order of _monster_flag_find() */
+static errr grab_one_monster_flag(u32b *flags[], cptr what)
+{
+    int code = _monster_flag_find(what);
+
+    if (code < 0) return -1;
+    *flags[_FLAG_TABLE(code)] |= (1L << _FLAG_BIT(code));
+    return 0;
 }
 
 
@@ -2415,16 +2500,12 @@ static errr grab_one_flag(u32b *flags, cptr names[], cptr what)
  */
 static errr grab_one_feat_flag(feature_type *f_ptr, cptr what)
 {
-    int i;
+    int i = _feat_flag_find(what);
 
-    /* Check flags */
-    for (i = 0; i < FF_FLAG_MAX; i++)
+    if (i >= 0)
     {
-        if (streq(what, f_info_flags[i]))
-        {
-            add_flag(f_ptr->flags, i);
-            return 0;
-        }
+        add_flag(f_ptr->flags, i);
+        return 0;
     }
 
     /* Oops */
@@ -2440,16 +2521,12 @@ static errr grab_one_feat_flag(feature_type *f_ptr, cptr what)
  */
 static errr grab_one_feat_action(feature_type *f_ptr, cptr what, int count)
 {
-    int i;
+    int i = _feat_flag_find(what);
 
-    /* Check flags */
-    for (i = 0; i < FF_FLAG_MAX; i++)
+    if (i >= 0)
     {
-        if (streq(what, f_info_flags[i]))
-        {
-            f_ptr->state[count].action = i;
-            return 0;
-        }
+        f_ptr->state[count].action = i;
+        return 0;
     }
 
     /* Oops */
@@ -2801,22 +2878,10 @@ void retouch_f_info(header *head)
  */
 static errr grab_one_kind_flag(object_kind *k_ptr, cptr what)
 {
-    int i;
-
     /* We really should check this someplace :) */
     assert((OF_COUNT + 31)/32 == OF_ARRAY_SIZE);
 
-    /* Check flags */
-    for (i = 0; i < OF_COUNT; i++)
-    {
-        if (streq(what, k_info_flags[i]))
-        {
-            add_flag(k_ptr->flags, i);
-            return (0);
-        }
-    }
-
-    if (grab_one_flag(&k_ptr->gen_flags, k_info_gen_flags, what) == 0)
+    if (grab_one_object_flag(k_ptr->flags, &k_ptr->gen_flags, what) == 0)
         return 0;
 
     /* Oops */
@@ -3091,19 +3156,7 @@ errr parse_k_info(char *buf, header *head)
  */
 static errr grab_one_artifact_flag(artifact_type *a_ptr, cptr what)
 {
-    int i;
-
-    /* Check flags */
-    for (i = 0; i < OF_COUNT; i++)
-    {
-        if (streq(what, k_info_flags[i]))
-        {
-            add_flag(a_ptr->flags, i);
-            return (0);
-        }
-    }
-
-    if (grab_one_flag(&a_ptr->gen_flags, k_info_gen_flags, what) == 0)
+    if (grab_one_object_flag(a_ptr->flags, &a_ptr->gen_flags, what) == 0)
         return 0;
 
     /* Oops */
@@ -3301,19 +3354,7 @@ errr parse_a_info(char *buf, header *head)
  */
 static bool grab_one_ego_item_flag(ego_type *e_ptr, cptr what)
 {
-    int i;
-
-    /* Check flags */
-    for (i = 0; i < OF_COUNT; i++)
-    {
-        if (streq(what, k_info_flags[i]))
-        {
-            add_flag(e_ptr->flags, i);
-            return (0);
-        }
-    }
-
-    if (grab_one_flag(&e_ptr->gen_flags, k_info_gen_flags, what) == 0)
+    if (grab_one_object_flag(e_ptr->flags, &e_ptr->gen_flags, what) == 0)
         return 0;
 
     /* Oops */
@@ -3506,25 +3547,10 @@ errr parse_e_info(char *buf, header *head)
  */
 static errr grab_one_basic_flag(monster_race *r_ptr, cptr what)
 {
-    if (grab_one_flag(&r_ptr->flags1, r_info_flags1, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&r_ptr->flags2, r_info_flags2, what) == 0)
-        return 0;
+    u32b *flags[] = { &r_ptr->flags1, &r_ptr->flags2, &r_ptr->flags3, &r_ptr->flags7,
+                      &r_ptr->flags8, &r_ptr->flags9, &r_ptr->flagsr };
 
-    if (grab_one_flag(&r_ptr->flags3, r_info_flags3, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&r_ptr->flags7, r_info_flags7, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&r_ptr->flags8, r_info_flags8, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&r_ptr->flags9, r_info_flags9, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&r_ptr->flagsr, r_info_flagsr, what) == 0)
+    if (grab_one_monster_flag(flags, what) == 0)
         return 0;
 
     /* Oops */
@@ -4289,13 +4315,34 @@ errr parse_r_info(char *buf, header *head)
 }
 
 
+/*
+ * Retouch r_info: cache the base spell distribution of each race
+ */
+void retouch_r_info(header *head)
+{
+    int i;
+
+    for (i = 0; i < head->info_num; i++)
+    {
+        monster_race *r_ptr = &r_info[i];
+
+        if (r_ptr->spells) mon_spells_ai_prepare(r_ptr->spells);
+    }
+}
+
+
 /*
  * Grab one flag for a dungeon type from a textual string
  */
 static errr grab_one_dungeon_flag(dungeon_info_type *d_ptr, cptr what)
 {
-    if (grab_one_flag(&d_ptr->flags1, d_info_flags1, what) == 0)
+    int i = _dungeon_flag_find(what);
+
+    if (i >= 0)
+    {
+        d_ptr->flags1 |= (1L << i);
         return 0;
+    }
 
     /* Oops */
     msg_format("Unknown dungeon type flag '%s'.", what);
@@ -4309,25 +4356,10 @@ static errr grab_one_dungeon_flag(dungeon_info_type *d_ptr, cptr what)
  */
 static errr grab_one_basic_monster_flag(dungeon_info_type *d_ptr, cptr what)
 {
-    if (grab_one_flag(&d_ptr->mflags1, r_info_flags1, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&d_ptr->mflags2, r_info_flags2, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&d_ptr->mflags3, r_info_flags3, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&d_ptr->mflags7, r_info_flags7, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&d_ptr->mflags8, r_info_flags8, what) == 0)
-        return 0;
+    u32b *flags[] = { &d_ptr->mflags1, &d_ptr->mflags2, &d_ptr->mflags3, &d_ptr->mflags7,
+                      &d_ptr->mflags8, &d_ptr->mflags9, &d_ptr->mflagsr };
 
-    if (grab_one_flag(&d_ptr->mflags9, r_info_flags9, what) == 0)
-        return 0;
-
-    if (grab_one_flag(&d_ptr->mflagsr, r_info_flagsr, what) == 0)
+    if (grab_one_monster_flag(flags, what) == 0)
         return 0;
 
     /* Oops */
@@ -5343,6 +5375,49 @@ errr process_dungeon_file(cptr name, int options)
     return (err);
 }
 
+static errr _parse_edit_line(cptr name, int line_num, char *buf, parser_f parser, int options, bool *bypass)
+{
+    errr err = 0;
+
+    if (!buf[0]) return 0; /* empty line */
+    if (isspace(buf[0])) return 0; /* blank line */
+    if (buf[0] == '#') return 0; /* comment */
+    if (buf[0] == '?' && buf[1] == ':') /* ?:<exp> conditional controls subsequent parsing */
+    {
+        char f;
+        cptr v;
+        char *s;
+
+        s = buf + 2;
+        v = process_dungeon_file_expr(&s, &f);
+        *bypass = streq(v, "0"); /* skip until subsequent ?: returns true */
+        return 0;
+    }
+    if (!(options & INIT_DEBUG) && *bypass) return 0; /* apply skip unless debugging */
+
+    if (buf[0] == '%' && buf[1] == ':') /* %:file.txt */
+        err = parse_edit_file(buf + 2, parser, options);
+    else
+    {
+        if (trace_doc && (buf[0] == 'L' || buf[0] == 'R'))
+        {
+            doc_printf(trace_doc, "<color:R>%s:%d</color> <indent>%s</indent>\n",
+                name, line_num, buf);
+        }
+        err = parser(buf, options);
+        if ((err) && (!(options & INIT_SILENT))) /* report now for recursion */
+        {
+            cptr oops = (err > 0 && err < PARSE_ERROR_MAX) ? err_str[err] : "unknown";
+
+            msg_boundary();
+            msg_format("<color:v>Error</color> %d (%s) at line %d of '%s'.", err, oops, line_num, name);
+            msg_format("Parsing '%s'.", buf);
+            msg_print(NULL); /* quit() during initialization ... */
+        }
+    }
+    return err;
+}
+
 errr parse_edit_file(cptr name, parser_f parser, int options)
 {
     FILE *fp;
@@ -5360,46 +5435,55 @@ errr parse_edit_file(cptr name, parser_f parser, int options)
     while (!err && 0 == my_fgets(fp, buf, sizeof(buf)))
     {
         line_num++;
+        err = _parse_edit_line(name, line_num, buf, parser, options, &bypass);
+    }
 
-        if (!buf[0]) continue; /* empty line */
-        if (isspace(buf[0])) continue; /* blank line */
-        if (buf[0] == '#') continue; /* comment */
-        if (buf[0] == '?' && buf[1] == ':') /* ?:<exp> conditional controls subsequent parsing */
-        {
-            char f;
-            cptr v;
-            char *s;
+    my_fclose(fp);
+    return err;
+}
 
-            s = buf + 2;
-            v = process_dungeon_file_expr(&s, &f);
-            bypass = streq(v, "0"); /* skip until subsequent ?: returns true */
-            continue;
-        }
-        if (!(options & INIT_DEBUG) && bypass) continue; /* apply skip unless debugging */
+/* Read an edit file into memory (one string per line) so that it may be
+ * parsed repeatedly with parse_edit_lines() without touching the disk.
+ * ?: conditionals are kept and evaluated on each parse, since they depend
+ * on the current game state. Returns NULL if the file cannot be opened. */
+vec_ptr load_edit_file(cptr name)
+{
+    FILE   *fp;
+    char    buf[1024];
+    vec_ptr lines;
 
-        if (buf[0] == '%' && buf[1] == ':') /* %:file.txt */
-            err = parse_edit_file(buf + 2, parser, options);
-        else
-        {
-            if (trace_doc && (buf[0] == 'L' || buf[0] == 'R'))
-            {
-                doc_printf(trace_doc, "<color:R>%s:%d</color> <indent>%s</indent>\n",
-                    name, line_num, buf);
-            }
-            err = parser(buf, options);
-            if ((err) && (!(options & INIT_SILENT))) /* report now for recursion */
-            {
-                cptr oops = (err > 0 && err < PARSE_ERROR_MAX) ? err_str[err] : "unknown";
+    path_build(buf, sizeof(buf), ANGBAND_DIR_EDIT, name);
+    fp = my_fopen(buf, "r");
+    if (!fp) return NULL;
 
-                msg_boundary();
-                msg_format("<color:v>Error</color> %d (%s) at line %d of '%s'.", err, oops, line_num, name);
-                msg_format("Parsing '%s'.", buf);
-                msg_print(NULL); /* quit() during initialization ... */
-            }
-        }
+    lines = vec_alloc(free);
+    while (0 == my_fgets(fp, buf, sizeof(buf)))
+    {
+        char *line = malloc(strlen(buf) + 1);
+        strcpy(line, buf);
+        vec_add(lines, line);
     }
 
     my_fclose(fp);
+    return lines;
+}
+
+errr parse_edit_lines(cptr name, vec_ptr lines, parser_f parser, int options)
+{
+    char buf[1024];
+    int  i;
+    errr err = 0;
+    bool bypass = FALSE;
+
+    assert(parser);
+    if (!lines) return (-1);
+
+    /* Parsers and ?: expressions tokenize in place, so work on a copy */
+    for (i = 0; !err && i < vec_length(lines); i++)
+    {
+        my_strcpy(buf, vec_get(lines, i), sizeof(buf));
+        err = _parse_edit_line(name, i + 1, buf, parser, options, &bypass);
+    }
     return err;
 }
 
@@ -622,6 +622,9 @@ static errr init_r_info(void)
     /* Save a pointer to the parsing function */
     r_head.parse_info_txt = parse_r_info;
 
+    /* Save a pointer to the retouch spell tables */
+    r_head.retouch = retouch_r_info;
+
 #endif /* ALLOW_TEMPLATES */
 
     return init_info("r_info", &r_head,
@@ -1011,6 +1014,8 @@ static errr init_other(void)
 
     /* Allocate and Wipe the monster list */
     C_MAKE(m_list, max_m_idx, monster_type);
+    C_MAKE(m_hot, max_m_idx, mon_hot_t);
+    C_MAKE(m_hot_active, (max_m_idx + 31) / 32, u32b);
 
     C_MAKE(pack_info_list, max_pack_info_idx, pack_info_t);
 
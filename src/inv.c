@@ -9,7 +9,10 @@ struct inv_s
     int     type;
     int     max;
     int     flags;
+    int     count;   /* occupied slots */
     vec_ptr objects; /* sparse ... grows as needed (up to max+1 if max is set) */
+    int_map_ptr kinds; /* k_idx -> first slot of that kind (cf _index_build) */
+    vec_ptr     next;  /* slot -> next slot of the same kind (0 ends the chain) */
 };
 
 /* Slots: We are assuming slot <= 26 */
@@ -40,29 +43,136 @@ static void _grow(inv_ptr inv, slot_t slot)
     }
 }
 
+/* Replace the object in a slot, keeping the occupied slot count current */
+static void _set(inv_ptr inv, slot_t slot, obj_ptr obj)
+{
+    if (vec_get(inv->objects, slot)) inv->count--;
+    if (obj) inv->count++;
+    vec_set(inv->objects, slot, obj);
+}
+
+/* Kind Index: Unbounded inventories (home, museum, shops) can hold hundreds
+ * of objects and are filled one object at a time, each time searching for a
+ * pile to combine with. obj_can_combine never matches objects of different
+ * kinds, so we chain the slots holding each k_idx in increasing slot order
+ * and only visit candidates of the right kind. The index is built on demand
+ * and dropped whenever the slot structure changes, except that _add_aux links
+ * the new slot in place. Bounded inventories (pack, quiver, equipment) are
+ * small enough that a scan is cheaper than the bookkeeping.
+ * Note: Objects owned by an indexed inventory must not change kind. */
+static bool _indexed(inv_ptr inv)
+{
+    return !inv->max && !(inv->flags & _FILTER);
+}
+
+static void _index_clear(inv_ptr inv)
+{
+    if (inv->kinds)
+    {
+        int_map_free(inv->kinds);
+        inv->kinds = NULL;
+    }
+}
+
+static void _index_grow(inv_ptr inv, slot_t slot)
+{
+    while (vec_length(inv->next) <= slot)
+        vec_add_int(inv->next, 0);
+}
+
+static void _index_build(inv_ptr inv)
+{
+    slot_t slot;
+
+    _index_clear(inv);
+    inv->kinds = int_map_alloc(NULL);
+    vec_clear(inv->next);
+    _index_grow(inv, vec_length(inv->objects));
+
+    /* Walk backwards, pushing each slot on the front of its chain */
+    for (slot = vec_length(inv->objects) - 1; slot > 0; slot--)
+    {
+        obj_ptr obj = vec_get(inv->objects, slot);
+        if (!obj) continue;
+        vec_set_int(inv->next, slot, (int)(intptr_t)int_map_find(inv->kinds, obj->k_idx));
+        int_map_add(inv->kinds, obj->k_idx, (vptr)(intptr_t)slot);
+    }
+}
+
+static void _index_add(inv_ptr inv, obj_ptr obj, slot_t slot)
+{
+    slot_t head, prev, next;
+
+    if (!inv->kinds) return;
+
+    _index_grow(inv, slot);
+    head = (slot_t)(intptr_t)int_map_find(inv->kinds, obj->k_idx);
+    if (!head || slot < head)
+    {
+        vec_set_int(inv->next, slot, head);
+        int_map_add(inv->kinds, obj->k_idx, (vptr)(intptr_t)slot);
+        return;
+    }
+    for (prev = head; ; prev = next)
+    {
+        next = vec_get_int(inv->next, prev);
+        if (!next || slot < next) break;
+    }
+    vec_set_int(inv->next, slot, next);
+    vec_set_int(inv->next, prev, slot);
+}
+
+/* Iterate the slots that might hold the same kind as obj (0 ends). Without
+ * an index, this is every occupied slot. Slots emptied since the index was
+ * built may still be visited. */
+static slot_t _kind_next(inv_ptr inv, slot_t prev)
+{
+    if (inv->kinds)
+        return vec_get_int(inv->next, prev);
+    for (prev++; prev < vec_length(inv->objects); prev++)
+    {
+        if (vec_get(inv->objects, prev))
+            return prev;
+    }
+    return 0;
+}
+
+static slot_t _kind_first(inv_ptr inv, obj_ptr obj)
+{
+    if (_indexed(inv))
+    {
+        if (!inv->kinds)
+            _index_build(inv);
+        return (slot_t)(intptr_t)int_map_find(inv->kinds, obj->k_idx);
+    }
+    return _kind_next(inv, 0);
+}
+
 /* Creation */
-inv_ptr inv_alloc(cptr name, int type, int max)
+static inv_ptr _alloc(cptr name, int type, int max, int flags, vec_free_f free)
 {
     inv_ptr result = malloc(sizeof(inv_t));
     result->name = name;
     result->type = type;
     result->max = max;
-    result->flags = 0;
-    result->objects = vec_alloc((vec_free_f)obj_free);
+    result->flags = flags;
+    result->count = 0;
+    result->objects = vec_alloc(free);
+    result->kinds = NULL;
+    result->next = vec_alloc(NULL);
     return result;
 }
 
+inv_ptr inv_alloc(cptr name, int type, int max)
+{
+    return _alloc(name, type, max, 0, (vec_free_f)obj_free);
+}
+
 inv_ptr inv_copy(inv_ptr src)
 {
-    inv_ptr result = malloc(sizeof(inv_t));
+    inv_ptr result = _alloc(src->name, src->type, src->max, src->flags, (vec_free_f)obj_free);
     int     i;
 
-    result->name = src->name;
-    result->type = src->type;
-    result->max = src->max;
-    result->flags = src->flags;
-    result->objects = vec_alloc((vec_free_f)obj_free);
-
     for (i = 0; i < vec_length(src->objects); i++)
     {
         obj_ptr obj = vec_get(src->objects, i);
@@ -71,6 +181,7 @@ inv_ptr inv_copy(inv_ptr src)
         else
             vec_add(result->objects, NULL);
     }
+    result->count = src->count;
     return result;
 }
 
@@ -90,21 +201,18 @@ static bool _filter(obj_ptr obj, obj_p p)
  * filtered inventory. (cf obj_prompt) */
 inv_ptr inv_filter(inv_ptr src, obj_p p)
 {
-    inv_ptr result = malloc(sizeof(inv_t));
+    inv_ptr result = _alloc(src->name, src->type, src->max, src->flags | _FILTER, NULL); /* src owns the objects! */
     int     i;
 
-    result->name = src->name;
-    result->type = src->type;
-    result->max = src->max;
-    result->flags = src->flags | _FILTER;
-    result->objects = vec_alloc(NULL); /* src owns the objects! */
-
     for (i = 0; i < vec_length(src->objects); i++)
     {
         obj_ptr obj = vec_get(src->objects, i);
 
         if (_filter(obj, p))
+        {
             vec_add(result->objects, obj);
+            if (obj) result->count++;
+        }
         else
             vec_add(result->objects, NULL);
     }
@@ -115,16 +223,10 @@ inv_ptr inv_filter(inv_ptr src, obj_p p)
  * preserve. This 'fake inventory' is useful for obj_prompt */
 inv_ptr inv_filter_floor(point_t loc, obj_p p)
 {
-    inv_ptr    result = malloc(sizeof(inv_t));
+    inv_ptr    result = _alloc("Floor", INV_FLOOR, 0, _FILTER, NULL); /* o_list owns the objects! */
     cave_type *c_ptr = &cave[loc.y][loc.x];
     int        this_o_idx, next_o_idx = 0;
 
-    result->name = "Floor";
-    result->type = INV_FLOOR;
-    result->max = 0;
-    result->flags = _FILTER;
-    result->objects = vec_alloc(NULL); /* o_list owns the objects! */
-
     vec_add(result->objects, NULL); /* slot 0 is invalid */
 
     if (0 && p_ptr->wizard) /* wizards have mighty magicks */
@@ -136,7 +238,10 @@ inv_ptr inv_filter_floor(point_t loc, obj_p p)
             assert(obj);
             if (!obj->k_idx) continue;
             if (_filter(obj, p))
+            {
                 vec_add(result->objects, obj);
+                result->count++;
+            }
         }
     }
     else
@@ -149,7 +254,10 @@ inv_ptr inv_filter_floor(point_t loc, obj_p p)
             assert(obj->k_idx);
             next_o_idx = obj->next_o_idx;
             if (_filter(obj, p))
+            {
                 vec_add(result->objects, obj);
+                result->count++;
+            }
         }
     }
     return result;
@@ -159,6 +267,8 @@ void inv_free(inv_ptr inv)
 {
     if (inv)
     {
+        _index_clear(inv);
+        vec_free(inv->next);
         vec_free(inv->objects);
         inv->objects = NULL;
         inv->name = NULL;
@@ -192,7 +302,10 @@ static void _add_aux(inv_ptr inv, obj_ptr obj, slot_t slot)
 
     if (slot >= vec_length(inv->objects))
         _grow(inv, slot);
-    vec_set(inv->objects, slot, copy);
+    if (vec_get(inv->objects, slot))
+        _index_clear(inv);
+    _set(inv, slot, copy);
+    _index_add(inv, copy, slot);
     copy->marked |= OM_DELAYED_MSG;
 
     obj->number -= ct;
@@ -237,7 +350,7 @@ slot_t inv_combine(inv_ptr inv, obj_ptr obj)
     assert(obj->number);
     assert(!(inv->flags & _FILTER));
 
-    for (slot = 1; slot < vec_length(inv->objects); slot++)
+    for (slot = _kind_first(inv, obj); slot; slot = _kind_next(inv, slot))
     {
         obj_ptr dest = vec_get(inv->objects, slot);
         if (!dest) continue;
@@ -265,7 +378,7 @@ bool inv_can_combine(inv_ptr inv, obj_ptr obj)
      * is only one possible candidate pile. In other words,
      * if there are multiple piles of the same object, all
      * but one contain 99 items. */
-    for (slot = 1; slot < vec_length(inv->objects); slot++)
+    for (slot = _kind_first(inv, obj); slot; slot = _kind_next(inv, slot))
     {
         obj_ptr dest = vec_get(inv->objects, slot);
         if (!dest) continue;
@@ -292,7 +405,7 @@ int inv_combine_ex(inv_ptr inv, obj_ptr obj)
     assert(!(inv->flags & _FILTER));
 
     /* combine obj with as many existing slots as possible */
-    for (slot = 1; slot < vec_length(inv->objects); slot++)
+    for (slot = _kind_first(inv, obj); slot; slot = _kind_next(inv, slot))
     {
         obj_ptr dest = vec_get(inv->objects, slot);
         if (!dest) continue;
@@ -310,20 +423,23 @@ int inv_combine_ex(inv_ptr inv, obj_ptr obj)
 bool inv_optimize(inv_ptr inv)
 {
     slot_t slot, seek;
-    bool result = FALSE;
+    bool result = FALSE, freed = FALSE;
     assert(!(inv->flags & _FILTER));
+    if (_indexed(inv) && !inv->kinds)
+        _index_build(inv);
     for (slot = 1; slot < vec_length(inv->objects); slot++)
     {
         obj_ptr dest = vec_get(inv->objects, slot);
         if (!dest) continue;
         if (!dest->number)
         {
-            vec_set(inv->objects, slot, NULL); /* free */
+            _set(inv, slot, NULL); /* free */
             dest = NULL;
             result = TRUE;
+            freed = TRUE;
             continue;
         }
-        for (seek = slot + 1; seek < vec_length(inv->objects); seek++)
+        for (seek = _kind_next(inv, slot); seek; seek = _kind_next(inv, seek))
         {
             obj_ptr src = vec_get(inv->objects, seek);
             if (!src) continue;
@@ -331,10 +447,15 @@ bool inv_optimize(inv_ptr inv)
             {
                 result = TRUE;
                 if (!src->number)
-                    vec_set(inv->objects, seek, NULL);
+                {
+                    _set(inv, seek, NULL);
+                    freed = TRUE;
+                }
             }
         }
     }
+    /* Emptied slots are still linked into the kind chains */
+    if (freed) _index_clear(inv);
     if (inv_sort(inv)) result = TRUE;
     return result;
 }
@@ -346,12 +467,17 @@ void inv_remove(inv_ptr inv, slot_t slot)
     assert(slot);
     obj = inv_obj(inv, slot);
     if (obj)
-        vec_set(inv->objects, slot, NULL); /* free */
+    {
+        _index_clear(inv);
+        _set(inv, slot, NULL); /* free */
+    }
 }
 
 void inv_clear(inv_ptr inv)
 {
+    _index_clear(inv);
     vec_clear(inv->objects);
+    inv->count = 0;
 }
 
 bool inv_sort(inv_ptr inv)
@@ -359,15 +485,79 @@ bool inv_sort(inv_ptr inv)
     return inv_sort_aux(inv, obj_cmp);
 }
 
+/* Sorting usually follows adding a single object to an already sorted
+ * inventory (or a handful, after a restock). Rather than resort from
+ * scratch, find the objects that are out of place by keeping a greedy
+ * sorted run and move just those into position with a binary search.
+ * Anything more disordered falls back to vec_sort_range. */
+#define _MAX_DISPLACED 8
+static int _sort_displaced(inv_ptr inv, int start, int stop, obj_cmp_f f)
+{
+    int     ct = 0, i;
+    obj_ptr last = vec_get(inv->objects, start);
+
+    for (i = start + 1; i <= stop; i++)
+    {
+        obj_ptr obj = vec_get(inv->objects, i);
+        if (f(last, obj) <= 0)
+            last = obj;
+        else if (++ct > _MAX_DISPLACED)
+            break;
+    }
+    return ct;
+}
+
+static void _sort_insert(inv_ptr inv, int start, int stop, obj_cmp_f f)
+{
+    int     i, j, kept = start;
+    obj_ptr last = vec_get(inv->objects, start);
+
+    /* Compact the sorted run to the front, displaced objects to the back */
+    for (i = start + 1; i <= stop; i++)
+    {
+        obj_ptr obj = vec_get(inv->objects, i);
+        if (f(last, obj) <= 0)
+        {
+            last = obj;
+            vec_swap(inv->objects, ++kept, i);
+        }
+    }
+
+    /* Insert each displaced object after the last object not greater than it */
+    for (i = kept + 1; i <= stop; i++)
+    {
+        obj_ptr obj = vec_get(inv->objects, i);
+        int     lo = start, hi = i;
+
+        while (lo < hi)
+        {
+            int mid = (lo + hi) / 2;
+            if (f(vec_get(inv->objects, mid), obj) <= 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        for (j = i; j > lo; j--)
+            vec_swap(inv->objects, j, j - 1);
+    }
+}
+
 bool inv_sort_aux(inv_ptr inv, obj_cmp_f f)
 {
     int start = 1, stop = vec_length(inv->objects) - 1;
-    if (start == stop) return FALSE;
+    int ct;
+    if (start >= stop) return FALSE;
     inv_for_each(inv, obj_clear_scratch);
-    if (!vec_is_sorted_range(inv->objects, start, stop, (vec_cmp_f)f))
+    ct = _sort_displaced(inv, start, stop, f);
+    if (ct)
     {
         slot_t slot;
-        vec_sort_range(inv->objects, start, stop, (vec_cmp_f)f);
+        if (ct <= _MAX_DISPLACED)
+            _sort_insert(inv, start, stop, f);
+        else
+            vec_sort_range(inv->objects, start, stop, (vec_cmp_f)f);
+        assert(vec_is_sorted_range(inv->objects, start, stop, (vec_cmp_f)f));
+        _index_clear(inv);
         /* It is OK to sort a filtered inv, but we better not update
          * locations for objects we do not own! */
         if (!(inv->flags & _FILTER))
@@ -395,6 +585,7 @@ void inv_swap(inv_ptr inv, slot_t left, slot_t right)
 
     _grow(inv, MAX(left, right)); /* force allocation of slots */
     vec_swap(inv->objects, left, right);
+    _index_clear(inv);
 
     obj = vec_get(inv->objects, left);
     if (obj) obj->loc.slot = left;
@@ -570,6 +761,7 @@ int inv_count_slots(inv_ptr inv, obj_p p)
 {
     int ct = 0;
     int slot;
+    if (p == obj_exists) return inv->count;
     for (slot = 1; slot < vec_length(inv->objects); slot++)
     {
         obj_ptr obj = inv_obj(inv, slot);
@@ -796,19 +988,18 @@ void inv_calculate_labels(inv_ptr inv, slot_t start, slot_t stop, int flags)
 void inv_load(inv_ptr inv, savefile_ptr file)
 {
     int i, ct, slot;
-    vec_clear(inv->objects);
+    inv_clear(inv);
     ct = savefile_read_s32b(file);
     for (i = 0; i < ct; i++)
     {
-        obj_ptr obj = malloc(sizeof(object_type));
-        object_wipe(obj);
+        obj_ptr obj = obj_alloc();
 
         slot = savefile_read_s32b(file);
         obj_load(obj, file);
 
         if (slot >= vec_length(inv->objects))
             _grow(inv, slot);
-        vec_set(inv->objects, slot, obj);
+        _set(inv, slot, obj);
     }
 }
 
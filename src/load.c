@@ -683,6 +683,7 @@ static void rd_extra(savefile_ptr file)
             r_ptr->flagsr = savefile_read_u32b(file);
             r_ptr->flags2 = savefile_read_u32b(file);
             r_ptr->flags7 = savefile_read_u32b(file);
+            mon_race_props_invalidate();
         }
     }
 
@@ -986,6 +987,7 @@ static errr rd_saved_floor(savefile_ptr file, saved_floor_type *sf_ptr)
         if (i != m_idx) return 162;
         m_ptr = &m_list[m_idx];
         rd_monster(file, m_ptr);
+        mon_hot_sync(m_idx);
         c_ptr = &cave[m_ptr->fy][m_ptr->fx];
         c_ptr->m_idx = m_idx;
         inc_cur_num(m_ptr, 1);
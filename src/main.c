@@ -501,6 +501,13 @@ int main(int argc, char *argv[])
 				break;
 			}
 
+			case 's':
+			case 'S':
+			{
+				arg_spoilers = TRUE;
+				break;
+			}
+
 
 			case '-':
 			{
@@ -527,6 +534,7 @@ int main(int argc, char *argv[])
 				puts("  -u<who>  Use your <who> savefile");
 				puts("  -m<sys>  Force 'main-<sys>.c' usage");
 				puts("  -d<def>  Define a 'lib' dir sub-path");
+				puts("  -s       Write the spoiler and help files for -u<who>, then quit");
 				puts("");
 
 #ifdef USE_SDL
@@ -3564,11 +3564,14 @@ static void process_monster(int m_idx)
                 /* Move the monster */
                 m_ptr->fy = ny;
                 m_ptr->fx = nx;
-                p_ptr->window |= PW_MONSTER_LIST; /* May have moved in our out of LOS */
 
                 /* Update the monster */
                 update_mon(m_idx, TRUE);
 
+                /* Seen monsters change the list by moving; update_mon()
+                 * handles monsters coming into or going out of view. */
+                if (m_ptr->ml) p_ptr->window |= PW_MONSTER_LIST;
+
                 /* Redraw the old grid */
                 lite_spot(oy, ox);
 
@@ -3913,40 +3916,48 @@ void process_monsters(void)
 
     int speed;
 
+    /* Glittering lures from AAF_LIMIT_RING, beyond the active band */
+    bool scan_all = (p_ptr->action == ACTION_GLITTER);
+
     /* Clear monster fighting indicator */
     mon_fight = FALSE;
 
     if (game_turn%TURNS_PER_TICK == 0)
         csleep_noise = (1L << (30 - p_ptr->skills.stl));
 
-    /* Process the monsters (backwards) */
-    for (i = m_max - 1; i >= 1; i--)
+    /* Process the monsters (backwards). Only the active band is visited:
+     * dormant monsters (see mon_hot_sync()) would fail the tests below
+     * anyway. The early tests only read m_hot[]. */
+    for (i = scan_all ? m_max - 1 : mon_hot_prev_active(m_max);
+         i >= 1;
+         i = scan_all ? i - 1 : mon_hot_prev_active(i))
     {
         int radius = 0;
-
-        /* Access the monster */
-        m_ptr = &m_list[i];
-        r_ptr = &r_info[m_ptr->r_idx];
+        mon_hot_ptr hot = &m_hot[i];
 
         /* Handle "leaving" */
         if (p_ptr->leaving) break;
 
         /* Ignore "dead" monsters */
-        if (!m_ptr->r_idx) continue;
+        if (!(hot->flags & MHOT_LIVE)) continue;
 
         if ((p_ptr->wild_mode) && (i != p_ptr->riding)) continue;
 
+        /* Access the monster */
+        m_ptr = &m_list[i];
+
         /* Handle "fresh" monsters */
-        if (m_ptr->mflag & MFLAG_BORN)
+        if (hot->flags & MHOT_BORN)
         {
             /* No longer "fresh" */
             m_ptr->mflag &= ~(MFLAG_BORN);
+            mon_hot_sync(i);
 
             /* Skip */
             continue;
         }
 
-        if (game_turn%TURNS_PER_TICK == 0)
+        if (game_turn%TURNS_PER_TICK == 0 && (hot->flags & MHOT_TIMED))
             process_mon_mtimed(m_ptr);
 
         if (p_ptr->wild_mode) continue;
@@ -3954,13 +3965,15 @@ void process_monsters(void)
         /* Hack -- Require proximity */
         if (p_ptr->action == ACTION_GLITTER)
         {
-            if (m_ptr->cdis >= AAF_LIMIT_RING) continue;
+            if (hot->cdis >= AAF_LIMIT_RING) continue;
         }
         else
         {
-            if (m_ptr->cdis >= AAF_LIMIT) continue;
+            if (hot->cdis >= AAF_LIMIT) continue;
         }
 
+        r_ptr = &r_info[m_ptr->r_idx];
+
         /* Access the location */
         fx = m_ptr->fx;
         fy = m_ptr->fy;
@@ -4150,6 +4163,7 @@ bool set_monster_paralyzed(int m_idx, int v)
             notice = TRUE;
     }
     m_ptr->mtimed[MTIMED_PARALYZED] = v;
+    mon_hot_sync(m_idx);
     if (notice)
     {
         if (m_ptr->ml)
@@ -4178,6 +4192,7 @@ bool set_monster_csleep(int m_idx, int v)
     }
 
     m_ptr->mtimed[MTIMED_CSLEEP] = v;
+    mon_hot_sync(m_idx);
 
     if (!notice) return FALSE;
 
@@ -4187,7 +4202,8 @@ bool set_monster_csleep(int m_idx, int v)
     if (r_info[m_ptr->r_idx].flags7 & RF7_HAS_LD_MASK)
         p_ptr->update |= (PU_MON_LITE);
 
-    p_ptr->window |= PW_MONSTER_LIST;
+    if (m_ptr->ml)
+        p_ptr->window |= PW_MONSTER_LIST;
 
     return TRUE;
 }
@@ -4210,6 +4226,7 @@ bool set_monster_fast(int m_idx, int v)
     }
 
     m_ptr->mtimed[MTIMED_FAST] = v;
+    mon_hot_sync(m_idx);
 
     if (!notice) return FALSE;
 
@@ -4240,6 +4257,7 @@ bool set_monster_slow(int m_idx, int v)
     }
 
     m_ptr->mtimed[MTIMED_SLOW] = v;
+    mon_hot_sync(m_idx);
 
     if (!notice) return FALSE;
 
@@ -4270,6 +4288,7 @@ bool set_monster_stunned(int m_idx, int v)
     }
 
     m_ptr->mtimed[MTIMED_STUNNED] = v;
+    mon_hot_sync(m_idx);
 
     if (m_ptr->ml)
         check_mon_health_redraw(m_idx);
@@ -4295,6 +4314,7 @@ bool set_monster_confused(int m_idx, int v)
     }
 
     m_ptr->mtimed[MTIMED_CONFUSED] = v;
+    mon_hot_sync(m_idx);
 
     if (m_ptr->ml)
         check_mon_health_redraw(m_idx);
@@ -4320,6 +4340,7 @@ bool set_monster_monfear(int m_idx, int v)
     }
 
     m_ptr->mtimed[MTIMED_MONFEAR] = v;
+    mon_hot_sync(m_idx);
 
     if (!notice) return FALSE;
 
@@ -4350,6 +4371,7 @@ bool set_monster_invulner(int m_idx, int v, bool energy_need)
     }
 
     m_ptr->mtimed[MTIMED_INVULNER] = v;
+    mon_hot_sync(m_idx);
 
     if (!notice) return FALSE;
 
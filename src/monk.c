@@ -63,11 +63,12 @@ typedef struct _attack_s {
     int to_d;
 } _attack_t;
 
+static int _get_weight(void);
+
 void _get_attack_counts(int tot, _attack_t *counts, int hand)
 {
     int i;
     _attack_t *_attack_ptr;
-    critical_t crit;
 
     for (i = 0; i < MAX_MA; i++)
     {
@@ -80,23 +81,22 @@ void _get_attack_counts(int tot, _attack_t *counts, int hand)
     for (i = 0; i < tot; i++)
     {
         int attack_idx = _get_attack_idx(p_ptr->monk_lvl, p_ptr->special_defense);
-        martial_arts *ma_ptr = &ma_blows[attack_idx];
 
         _attack_ptr = &counts[attack_idx];
         _attack_ptr->count++;
+    }
+
+    /* Crits depend on the attack chosen (cf monk_get_critical) */
+    for (i = 0; i < MAX_MA; i++)
+    {
+        martial_arts *ma_ptr = &ma_blows[i];
+        critical_odds_t odds;
 
-        /* Crits depend on the attack chosen. The following won't be stable
-           for attacks that occur infrequently, but hopefully things will just
-           average out */
-        crit = monk_get_critical(ma_ptr, hand, display_weapon_mode);
+        _attack_ptr = &counts[i];
+        if (!_attack_ptr->count) continue;
 
-        if (crit.desc)
-        {
-            _attack_ptr->mul += crit.mul;
-            _attack_ptr->to_d += crit.to_d;
-        }
-        else
-            _attack_ptr->mul += 100;
+        odds = critical_norm_odds(_get_weight(), ma_ptr->min_level, p_ptr->weapon_info[hand].to_h, display_weapon_mode, 0);
+        _attack_ptr->mul = _attack_ptr->count * critical_avg_mul(odds);
     }
 }
 
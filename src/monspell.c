@@ -1265,6 +1265,8 @@ void mon_spells_free(mon_spells_ptr spells)
                 mon_spell_group_free(group);
             spells->groups[i] = NULL;
         }
+        if (spells->ai_prob)
+            free(spells->ai_prob);
         free(spells);
     }
 }
@@ -1279,6 +1281,13 @@ void mon_spells_add(mon_spells_ptr spells, mon_spell_ptr spell)
         spells->groups[spell->id.type] = group;
     }
     mon_spell_group_add(group, spell);
+
+    /* Blue-mage hacks add spells after r_info is loaded: rebuild on next cast */
+    if (spells->ai_prob)
+    {
+        free(spells->ai_prob);
+        spells->ai_prob = NULL;
+    }
 }
 
 errr mon_spells_parse(mon_spells_ptr spells, int rlev, char *token)
@@ -1295,6 +1304,36 @@ errr mon_spells_parse(mon_spells_ptr spells, int rlev, char *token)
     return rc;
 }
 
+/* The AI starts every cast from the same per-race distribution, so compute
+ * it once (after r_info is parsed) rather than on each cast. Note that the
+ * base distribution is kept apart from spell->prob since the blue-mage hack
+ * races use that field to store spell levels. */
+void mon_spells_ai_prepare(mon_spells_ptr spells)
+{
+    int i, j, k = 0;
+
+    spells->ai_count = 0;
+    for (i = 0; i < MST_COUNT; i++)
+    {
+        mon_spell_group_ptr group = spells->groups[i];
+        if (group) spells->ai_count += group->count;
+    }
+
+    if (spells->ai_prob) free(spells->ai_prob);
+    spells->ai_prob = malloc(MAX(1, spells->ai_count));
+    for (i = 0; i < MST_COUNT; i++)
+    {
+        mon_spell_group_ptr group = spells->groups[i];
+        _mst_info_ptr       mp;
+        if (!group) continue;
+        mp = _mst_lookup(i);
+        assert(mp);
+        for (j = 0; j < group->count; j++)
+            spells->ai_prob[k++] = mp->prob;
+    }
+    assert(k == spells->ai_count);
+}
+
 vec_ptr mon_spells_all(mon_spells_ptr spells)
 {
     vec_ptr v = vec_alloc(NULL);
@@ -3417,22 +3456,71 @@ static void _spell_msg(void)
 /*************************************************************************
  * AI
  ************************************************************************/
-static void _ai_init(mon_spells_ptr spells)
+/* The AI never touches race->spells. Instead, each cast works on a scratch
+ * copy (cast->spells) with the same group layout, seeded from the race's
+ * precomputed base distribution. The copied spells live in one flat buffer
+ * in group order, which lets _choose_random binary search a cumulative
+ * table. The buffer is on the stack unless the race is unusually large. */
+#define _AI_STACK_MAX 100
+typedef struct {
+    mon_spells_t      spells;
+    mon_spell_group_t groups[MST_COUNT];
+    mon_spell_ptr     buf;
+    int              *cumul;
+    mon_spell_t       stack_buf[_AI_STACK_MAX];
+    int               stack_cumul[_AI_STACK_MAX];
+} _ai_spells_t, *_ai_spells_ptr;
+
+static void _ai_init(mon_spell_cast_ptr cast, _ai_spells_ptr scratch)
 {
-    int i, j;
+    mon_spells_ptr spells = cast->race->spells;
+    int            i, j, k = 0;
+
+    if (!spells->ai_prob)
+        mon_spells_ai_prepare(spells);
+
+    memset(&scratch->spells, 0, sizeof(mon_spells_t));
+    scratch->spells.freq = spells->freq;
+    scratch->spells.flags = spells->flags;
+    scratch->spells.ai_count = spells->ai_count;
+    if (spells->ai_count > _AI_STACK_MAX)
+    {
+        scratch->buf = malloc(sizeof(mon_spell_t) * spells->ai_count);
+        scratch->cumul = malloc(sizeof(int) * spells->ai_count);
+    }
+    else
+    {
+        scratch->buf = scratch->stack_buf;
+        scratch->cumul = scratch->stack_cumul;
+    }
+
     for (i = 0; i < MST_COUNT; i++)
     {
         mon_spell_group_ptr group = spells->groups[i];
-        _mst_info_ptr       mp;
+        mon_spell_group_ptr copy = &scratch->groups[i];
         if (!group) continue;
-        mp = _mst_lookup(i);
-        assert(mp);
-        for (j = 0; j < group->count; j++)
+        *copy = *group;
+        copy->spells = scratch->buf + k;
+        copy->allocated = group->count;
+        scratch->spells.groups[i] = copy;
+        for (j = 0; j < group->count; j++, k++)
         {
-            mon_spell_ptr spell = &group->spells[j];
-            spell->prob = mp->prob;
+            scratch->buf[k] = group->spells[j];
+            scratch->buf[k].prob = spells->ai_prob[k];
         }
     }
+    assert(k == spells->ai_count);
+    cast->spells = &scratch->spells;
+}
+
+static void _ai_done(mon_spell_cast_ptr cast, _ai_spells_ptr scratch)
+{
+    if (scratch->buf != scratch->stack_buf)
+    {
+        free(scratch->buf);
+        free(scratch->cumul);
+    }
+    cast->spells = NULL;
 }
 
 static bool _projectable(point_t src, point_t dest)
@@ -3675,7 +3763,7 @@ static void _remove_spell(mon_spells_ptr spells, mon_spell_id_t id)
 
 static void _smart_remove(mon_spell_cast_ptr cast)
 {
-    mon_spells_ptr spells = cast->race->spells;
+    mon_spells_ptr spells = cast->spells;
     u32b           flags = cast->mon->smart;
 
     if (smart_cheat) flags = 0xFFFFFFFF;
@@ -3722,7 +3810,7 @@ static int _wall_ct(point_t pt)
 static void _ai_wounded(mon_spell_cast_ptr cast)
 {
     bool           smart  = BOOL(cast->race->flags2 & RF2_SMART);
-    mon_spells_ptr spells = cast->race->spells;
+    mon_spells_ptr spells = cast->spells;
     if ( spells->groups[MST_HEAL]
       || spells->groups[MST_ESCAPE]
       || spells->groups[MST_SUMMON] )
@@ -3761,7 +3849,7 @@ static void _ai_direct(mon_spell_cast_ptr cast)
 {
     bool           stupid = BOOL(cast->race->flags2 & RF2_STUPID);
     bool           smart  = BOOL(cast->race->flags2 & RF2_SMART);
-    mon_spells_ptr spells = cast->race->spells;
+    mon_spells_ptr spells = cast->spells;
     mon_spell_ptr  spell;
 
     cast->flags |= MSC_DIRECT;
@@ -3945,7 +4033,7 @@ static void _ai_indirect(mon_spell_cast_ptr cast)
 {
     bool           stupid = BOOL(cast->race->flags2 & RF2_STUPID);
     bool           smart = BOOL(cast->race->flags2 & RF2_SMART);
-    mon_spells_ptr spells = cast->race->spells;
+    mon_spells_ptr spells = cast->spells;
     mon_spell_ptr  spell;
     point_t        new_dest = {0};
     int            prob = 0;
@@ -4052,24 +4140,24 @@ static void _ai_think(mon_spell_cast_ptr cast)
 {
     /* Hack: Restrict for special dungeons or town buildings */
     if (p_ptr->inside_arena || p_ptr->inside_battle)
-        _remove_group(cast->race->spells->groups[MST_SUMMON], NULL);
+        _remove_group(cast->spells->groups[MST_SUMMON], NULL);
 
     /* Hack */
     if ((cast->race->id == MON_HEIMDALL) && (!py_in_dungeon()))
-        _remove_spell(cast->race->spells, _id(MST_SUMMON, SUMMON_PANTHEON));
+        _remove_spell(cast->spells, _id(MST_SUMMON, SUMMON_PANTHEON));
 
     if (p_ptr->no_air)
-        _remove_spell(cast->race->spells, _id(MST_ANNOY, ANNOY_NO_AIR));
+        _remove_spell(cast->spells, _id(MST_ANNOY, ANNOY_NO_AIR));
 
     if (cast->flags & MSC_DEST_PLAYER)
     {
         /* Being tele-leveled out of giant slayer is too annoying */
         if (quest_id_current())
-            _remove_spell(cast->race->spells, _id(MST_ANNOY, ANNOY_TELE_LEVEL));
+            _remove_spell(cast->spells, _id(MST_ANNOY, ANNOY_TELE_LEVEL));
 
         /* Don't try Poly Other if the player is known to resist */
         if (player_obviously_poly_immune(TRUE))
-            _remove_spell(cast->race->spells, _id(MST_BIFF, BIFF_POLYMORPH));
+            _remove_spell(cast->spells, _id(MST_BIFF, BIFF_POLYMORPH));
     }
 
     /* Generally, we require direct los to spell against the player.
@@ -4081,44 +4169,49 @@ static void _ai_think(mon_spell_cast_ptr cast)
         _ai_indirect(cast);
 }
 
-static mon_spell_ptr _choose_random(mon_spells_ptr spells)
+static mon_spell_ptr _choose_random(_ai_spells_ptr scratch)
 {
-    int i, j, total = 0, roll;
-    for (i = 0; i < MST_COUNT; i++)
+    int i, total = 0, roll, lo, hi;
+    for (i = 0; i < scratch->spells.ai_count; i++)
     {
-        mon_spell_group_ptr group = spells->groups[i];
-        if (!group) continue;
-        for (j = 0; j < group->count; j++)
-        {
-            mon_spell_ptr spell = &group->spells[j];
-            total += spell->prob;
-        }
+        total += scratch->buf[i].prob;
+        scratch->cumul[i] = total;
     }
     if (!total) return NULL;
     roll = randint1(total);
-    for (i = 0; i < MST_COUNT; i++)
+
+    /* first spell whose cumulative probability reaches roll */
+    lo = 0;
+    hi = scratch->spells.ai_count - 1;
+    while (lo < hi)
     {
-        mon_spell_group_ptr group = spells->groups[i];
-        if (!group) continue;
-        for (j = 0; j < group->count; j++)
-        {
-            mon_spell_ptr spell = &group->spells[j];
-            roll -= spell->prob;
-            if (roll <= 0) return spell;
-        }
+        int mid = (lo + hi) / 2;
+        if (scratch->cumul[mid] < roll) lo = mid + 1;
+        else hi = mid;
     }
-    return NULL; /* ?! */
+    return &scratch->buf[lo];
 }
-static void _ai_choose(mon_spell_cast_ptr cast)
+static void _ai_choose(mon_spell_cast_ptr cast, _ai_spells_ptr scratch)
 {
-    cast->spell = _choose_random(cast->race->spells);
+    mon_spell_ptr spell = _choose_random(scratch);
+
+    cast->spell = NULL;
+    if (spell)
+    {
+        /* map the scratch copy back to the race so lore (etc) is updated */
+        int                 type = spell->id.type;
+        mon_spell_group_ptr group = cast->race->spells->groups[type];
+        cast->spell = &group->spells[spell - scratch->groups[type].spells];
+    }
 }
 static bool _default_ai(mon_spell_cast_ptr cast)
 {
+    _ai_spells_t scratch;
     if (!cast->race->spells) return FALSE;
-    _ai_init(cast->race->spells);
+    _ai_init(cast, &scratch);
     _ai_think(cast);
-    _ai_choose(cast);
+    _ai_choose(cast, &scratch);
+    _ai_done(cast, &scratch);
     return cast->spell != NULL;
 }
 
@@ -4202,7 +4295,7 @@ static bool _real_ball_p(mon_spell_ptr spell)
 }
 static void _avoid_hurting_player(mon_spell_cast_ptr cast)
 {
-    mon_spells_ptr spells = cast->race->spells;
+    mon_spells_ptr spells = cast->spells;
     mon_spell_ptr  spell;
     {
         if (spells->groups[MST_BALL])
@@ -4278,7 +4371,7 @@ static void _avoid_hurting_player(mon_spell_cast_ptr cast)
 }
 static void _ai_think_pet(mon_spell_cast_ptr cast)
 {
-    mon_spells_ptr spells = cast->race->spells;
+    mon_spells_ptr spells = cast->spells;
     mon_spell_ptr  spell;
 
     assert(is_pet(cast->mon));
@@ -4330,7 +4423,7 @@ static void _ai_think_pet(mon_spell_cast_ptr cast)
 
 static void _ai_think_friend(mon_spell_cast_ptr cast)
 {
-    mon_spells_ptr spells = cast->race->spells;
+    mon_spells_ptr spells = cast->spells;
 
     assert(is_friendly(cast->mon));
 
@@ -4348,7 +4441,7 @@ static void _ai_think_friend(mon_spell_cast_ptr cast)
 
 static void _ai_think_mon(mon_spell_cast_ptr cast)
 {
-    mon_spells_ptr spells = cast->race->spells;
+    mon_spells_ptr spells = cast->spells;
     mon_spell_ptr  spell;
 
     /* _choose_target only selects projectable foes for now */
@@ -4435,11 +4528,13 @@ static void _ai_think_mon(mon_spell_cast_ptr cast)
 }
 static bool _default_ai_mon(mon_spell_cast_ptr cast)
 {
+    _ai_spells_t scratch;
     if (!cast->race->spells) return FALSE;
     if (!_choose_target(cast)) return FALSE;
-    _ai_init(cast->race->spells);
+    _ai_init(cast, &scratch);
     _ai_think_mon(cast);
-    _ai_choose(cast);
+    _ai_choose(cast, &scratch);
+    _ai_done(cast, &scratch);
     return cast->spell != NULL;
 }
 
@@ -4528,22 +4623,35 @@ int _avg_spell_dam(mon_ptr mon, mon_spell_ptr spell)
 {
     return _avg_spell_dam_aux(spell, mon->hp, TRUE);
 }
-void mon_spell_wizard(mon_ptr mon, mon_spell_ai ai, doc_ptr doc)
+void mon_spell_wizard(mon_ptr mon, doc_ptr doc)
 {
     mon_spell_cast_t cast = {0};
+    _ai_spells_t     scratch;
     int              i, j, total = 0, total_dam = 0;
     _spell_cast_init(&cast, mon);
-    if (!ai) ai = _default_ai;
     if (!cast.race->spells) return;
-    if (!ai(&cast))
+
+    /* Run the default ai by hand so we can report its scratch probabilities */
+    _ai_init(&cast, &scratch);
+    _ai_think(&cast);
+    _ai_choose(&cast, &scratch);
+    if (!cast.spell)
     {
-        ai = _default_ai_mon;
-        if (!ai(&cast)) return;
+        _ai_done(&cast, &scratch);
+        if (!_choose_target(&cast)) return;
+        _ai_init(&cast, &scratch);
+        _ai_think_mon(&cast);
+        _ai_choose(&cast, &scratch);
+        if (!cast.spell)
+        {
+            _ai_done(&cast, &scratch);
+            return;
+        }
     }
-    doc_printf(doc, "%s: %d%%\n", cast.name, cast.race->spells->freq);
+    doc_printf(doc, "%s: %d%%\n", cast.name, cast.spells->freq);
     for (i = 0; i < MST_COUNT; i++)
     {
-        mon_spell_group_ptr group = cast.race->spells->groups[i];
+        mon_spell_group_ptr group = cast.spells->groups[i];
         if (!group) continue;
         group->prob = 0;
         for (j = 0; j < group->count; j++)
@@ -4553,10 +4661,14 @@ void mon_spell_wizard(mon_ptr mon, mon_spell_ai ai, doc_ptr doc)
             group->prob += spell->prob;
         }
     }
-    if (!total) return;
+    if (!total)
+    {
+        _ai_done(&cast, &scratch);
+        return;
+    }
     for (i = 0; i < MST_COUNT; i++)
     {
-        mon_spell_group_ptr group = cast.race->spells->groups[i];
+        mon_spell_group_ptr group = cast.spells->groups[i];
         _mst_info_ptr       mp;
         if (!group) continue;
         mp = _mst_lookup(i);
@@ -4600,6 +4712,7 @@ void mon_spell_wizard(mon_ptr mon, mon_spell_ai ai, doc_ptr doc)
     }
     doc_printf(doc, "<tab:65><color:r>%d</color>", total_dam / total);
     doc_newline(doc);
+    _ai_done(&cast, &scratch);
 }
 
 /*************************************************************************
@@ -5619,6 +5732,7 @@ void blue_mage_learn_spell_aux(byte type, s16b effect, s16b lore, s16b seniority
     _blue_mage_group_hack = TRUE;
     mon_spells_add(r_ptr->spells, &spell);
     _blue_mage_group_hack = FALSE;
+    mon_race_props_invalidate();
 
     if (seniority < 1)
     {
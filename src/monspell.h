@@ -119,12 +119,15 @@ typedef struct {
     byte freq;
     u32b flags;
     mon_spell_group_ptr groups[MST_COUNT];
+    int   ai_count; /* total spells in all groups (cf mon_spells_ai_prepare) */
+    byte *ai_prob;  /* base ai probability of each spell, in group order */
 } mon_spells_t, *mon_spells_ptr;
 
 extern mon_spells_ptr mon_spells_alloc(void);
 extern void           mon_spells_free(mon_spells_ptr spells);
 extern void           mon_spells_add(mon_spells_ptr spells, mon_spell_ptr spell);
 extern errr           mon_spells_parse(mon_spells_ptr spells, int rlev, char *token);
+extern void           mon_spells_ai_prepare(mon_spells_ptr spells);
 extern vec_ptr        mon_spells_all(mon_spells_ptr spells);
 extern mon_spell_ptr  mon_spells_find(mon_spells_ptr spells, mon_spell_id_t id);
 extern mon_spell_ptr  mon_spells_random(mon_spells_ptr spells); /* stupid monsters */
@@ -149,8 +152,9 @@ extern void           mon_spells_save(mon_spells_ptr spells, savefile_ptr file);
 typedef struct {
     mon_ptr       mon;             /* Src monster or null if MSC_SRC_PLAYER */
     char          name[MAX_NLEN];
-    mon_race_ptr  race;            /* race->spells contains accurate probabilities for debugging */
-    mon_spell_ptr spell;
+    mon_race_ptr  race;
+    mon_spells_ptr spells;         /* AI scratch copy of race->spells with situational probabilities */
+    mon_spell_ptr spell;           /* Always points into race->spells */
     point_t       src;
     point_t       dest;            /* Might be near MSC_DEST_* if MSC_SPLASH */
     mon_ptr       mon2;            /* Dest monster if MSC_DEST_MONSTER */
@@ -165,7 +169,7 @@ extern bool           mon_spell_ai_wizard(mon_spell_cast_ptr cast);
 extern int            mon_spell_cost(mon_spell_ptr spell, mon_race_ptr race);
 extern bool           mon_spell_cast(mon_ptr mon, mon_spell_ai ai);
 extern bool           mon_spell_cast_mon(mon_ptr mon, mon_spell_ai ai);
-extern void           mon_spell_wizard(mon_ptr mon, mon_spell_ai ai, doc_ptr doc);
+extern void           mon_spell_wizard(mon_ptr mon, doc_ptr doc);
 extern mon_spell_ptr  mon_spell_find(mon_race_ptr race, mon_spell_id_t id);
 extern bool           mon_spell_cast_possessor(mon_race_ptr race);
 
@@ -209,6 +209,8 @@ void delete_monster_idx(int i)
 
     s16b this_o_idx, next_o_idx = 0;
 
+    bool listed = m_ptr->ml;
+
     /* Get location */
     y = m_ptr->fy;
     x = m_ptr->fx;
@@ -270,6 +272,7 @@ void delete_monster_idx(int i)
 
     /* Wipe the Monster */
     (void)WIPE(m_ptr, monster_type);
+    mon_hot_sync(i);
 
     /* Count monsters */
     m_cnt--;
@@ -288,7 +291,8 @@ void delete_monster_idx(int i)
         p_ptr->duelist_target_idx = 0;
         p_ptr->redraw |= PR_STATUS;
     }
-    p_ptr->window |= PW_MONSTER_LIST;
+    if (listed)
+        p_ptr->window |= PW_MONSTER_LIST;
 }
 
 
@@ -401,9 +405,11 @@ static void compact_monsters_aux(int i1, int i2)
 
     /* Structure copy */
     COPY(&m_list[i2], &m_list[i1], monster_type);
+    mon_hot_sync(i2);
 
     /* Wipe the hole */
     (void)WIPE(&m_list[i1], monster_type);
+    mon_hot_sync(i1);
 }
 
 
@@ -559,6 +565,9 @@ void wipe_m_list(void)
     /* Hack -- Wipe the racial counter of all monster races */
     for (i = 1; i < max_r_idx; i++) r_info[i].cur_num = 0;
 
+    C_WIPE(m_hot, max_m_idx, mon_hot_t);
+    C_WIPE(m_hot_active, (max_m_idx + 31) / 32, u32b);
+
     /* Reset "m_max" */
     m_max = 1;
 
@@ -800,6 +809,66 @@ pack_info_t *pack_info_ptr(int m_idx)
 }
 
 
+/*
+ * Refresh m_hot[m_idx] from m_list[m_idx]. Call this whenever a monster
+ * is created, moved in the list or wiped, and whenever its distance,
+ * MFLAG_BORN, timed effects or minislow change.
+ */
+void mon_hot_sync(int m_idx)
+{
+    monster_type *m_ptr = &m_list[m_idx];
+    mon_hot_ptr   hot = &m_hot[m_idx];
+    u32b          bit = 1U << (m_idx % 32);
+    bool          busy = FALSE;
+
+    hot->cdis = m_ptr->cdis;
+    hot->flags = 0;
+    m_hot_active[m_idx / 32] &= ~bit;
+    if (!m_ptr->r_idx) return;
+
+    hot->flags |= MHOT_LIVE;
+    if (m_ptr->mflag & MFLAG_BORN)
+        hot->flags |= MHOT_BORN;
+    if ( m_ptr->mtimed[MTIMED_FAST] || m_ptr->mtimed[MTIMED_SLOW]
+      || m_ptr->mtimed[MTIMED_STUNNED] || m_ptr->mtimed[MTIMED_CONFUSED]
+      || m_ptr->mtimed[MTIMED_INVULNER] || m_ptr->minislow )
+    {
+        busy = TRUE;
+        hot->flags |= MHOT_TIMED;
+    }
+    if (m_ptr->mtimed[MTIMED_CSLEEP])
+        hot->flags |= MHOT_TIMED;
+
+    /* Sleep is left out: process_mon_mtimed() only counts it down within
+     * AAF_LIMIT, so a far sleeper has nothing to do until update_mon()
+     * brings it closer. */
+    if (busy || (hot->flags & MHOT_BORN) || hot->cdis < AAF_LIMIT)
+        m_hot_active[m_idx / 32] |= bit;
+}
+
+/*
+ * The highest active monster index below m_idx, or 0 if there is none.
+ * This skips 32 dormant slots per word, so visiting the active monsters
+ * costs little more than their number.
+ */
+int mon_hot_prev_active(int m_idx)
+{
+    int  w, b;
+    u32b bits;
+
+    if (--m_idx < 1) return 0;
+
+    w = m_idx / 32;
+    bits = m_hot_active[w] & (0xFFFFFFFFU >> (31 - m_idx % 32));
+    while (!bits)
+    {
+        if (--w < 0) return 0;
+        bits = m_hot_active[w];
+    }
+    for (b = 31; !(bits & (1U << b)); b--) {}
+    return w * 32 + b;
+}
+
 /*
  * Acquires and returns the index of a "free" monster.
  *
@@ -818,6 +887,7 @@ s16b m_pop(void)
         m_cnt++;
         WIPE(&m_list[i], monster_type);
         m_list[i].id = i;
+        mon_hot_sync(i);
         return (i);
     }
     /* Recycle dead monsters */
@@ -829,6 +899,7 @@ s16b m_pop(void)
         m_cnt++;
         WIPE(m_ptr, monster_type);
         m_ptr->id = i;
+        mon_hot_sync(i);
         return (i);
     }
 
@@ -882,7 +953,7 @@ byte monster_pantheon(monster_race *r_ptr)
     return 0;
 }
 
-bool mon_is_type(int r_idx, int type)
+static bool _mon_is_type_aux(int r_idx, int type)
 {
     monster_race *r_ptr = &r_info[r_idx];
 
@@ -1244,43 +1315,122 @@ bool mon_is_type(int r_idx, int type)
     return FALSE;
 }
 
+/************************************************************************
+ * Precomputed Race Properties
+ *
+ * mon_is_type() and restrict_monster_to_dungeon() are called for every
+ * entry of the allocation table on each get_mon_num_prep(), and most of
+ * what they test (flags, symbols, spell lists) never changes once r_info
+ * is loaded. We compile those answers into bitsets on first use: one bit
+ * per static SUMMON_* type for each race, and one bit per race for the
+ * flag/symbol rules of each dungeon. Anything that depends on game state
+ * (the chapel types, pantheon, kin, dead uniques, guardians and the
+ * dynamic prefix of the dungeon rules) is still evaluated live.
+ *
+ * Call mon_race_props_invalidate() after rewriting r_info or d_info.
+ ************************************************************************/
+#define _TYPE_WORDS ((SUMMON_NAGA + 32) / 32)
+
+enum {
+    _RP_SUMMONER = 0x01,     /* mon_race_can_summon(race, -1) */
+    _RP_INNATE_SPELL = 0x02, /* mon_race_has_innate_spell(race) */
+    _RP_ATTACK_SPELL = 0x04, /* mon_race_has_attack_spell(race) */
+};
 
-static int chameleon_change_m_idx = 0;
+typedef struct {
+    u32b types[_TYPE_WORDS];
+    u32b flags;
+} _race_props_t, *_race_props_ptr;
 
+static _race_props_ptr _race_props = NULL;
+static u32b          **_dun_masks = NULL;
+static int             _dun_mask_words = 0;
 
-/*
- * Some dungeon types restrict the possible monsters.
- * Return TRUE is the monster is OK and FALSE otherwise
- */
-bool restrict_monster_to_dungeon(int r_idx, int which)
+static bool _type_is_dynamic(int type)
 {
-    dungeon_info_type *d_ptr = &d_info[which];
-    monster_race *r_ptr = &r_info[r_idx];
-    byte a;
+    switch (type)
+    {
+    case SUMMON_CHAPEL_GOOD: /* vault_monster_okay() depends on dungeon_type */
+    case SUMMON_CHAPEL_EVIL:
+    case SUMMON_PANTHEON:    /* summon_pantheon_hack */
+    case SUMMON_KIN:         /* summon_kin_type */
+    case SUMMON_DEAD_UNIQ:   /* max_num and cur_num */
+    case SUMMON_GUARDIAN:    /* RF7_GUARDIAN is toggled as dungeons are won */
+        return TRUE;
+    }
+    return FALSE;
+}
 
-    if (d_ptr->flags1 & DF1_CHAMELEON)
+static void _race_props_build(void)
+{
+    int r_idx, type;
+
+    C_MAKE(_race_props, max_r_idx, _race_props_t);
+    for (r_idx = 0; r_idx < max_r_idx; r_idx++)
     {
-        if (chameleon_change_m_idx) return TRUE;
+        monster_race   *r_ptr = &r_info[r_idx];
+        _race_props_ptr props = &_race_props[r_idx];
+
+        for (type = 0; type <= SUMMON_NAGA; type++)
+        {
+            if (_type_is_dynamic(type)) continue;
+            if (_mon_is_type_aux(r_idx, type))
+                props->types[type / 32] |= 1U << (type % 32);
+        }
+        if (mon_race_can_summon(r_ptr, -1)) props->flags |= _RP_SUMMONER;
+        if (mon_race_has_innate_spell(r_ptr)) props->flags |= _RP_INNATE_SPELL;
+        if (mon_race_has_attack_spell(r_ptr)) props->flags |= _RP_ATTACK_SPELL;
     }
-    if (d_ptr->flags1 & DF1_NO_MAGIC)
+}
+
+static _race_props_ptr _race_props_get(int r_idx)
+{
+    if (!_race_props) _race_props_build();
+    return &_race_props[r_idx];
+}
+
+void mon_race_props_invalidate(void)
+{
+    int i;
+    if (_race_props)
     {
-        if (r_idx != MON_CHAMELEON && !mon_race_has_innate_spell(r_ptr))
-            return FALSE;
-    }                                                              /* v--- ...but prevent the Summon Mold exploit. Sigh ... */
-    if (d_ptr->flags1 & DF1_NO_MELEE && (summon_specific_who != -1 || !allow_pets))
-    {                                 /* ^---- Block players spamming the anti-melee cave for better summons... */
-        if (r_idx == MON_CHAMELEON) return TRUE;
-        if (!mon_race_has_attack_spell(r_ptr)) return FALSE;
+        C_KILL(_race_props, max_r_idx, _race_props_t);
+        _race_props = NULL;
     }
-    if (d_ptr->flags1 & DF1_BEGINNER)
+    if (_dun_masks)
     {
-        if (r_ptr->level > dun_level)
-            return FALSE;
+        for (i = 0; i < max_d_idx; i++)
+        {
+            if (_dun_masks[i])
+                C_KILL(_dun_masks[i], _dun_mask_words, u32b);
+        }
+        C_KILL(_dun_masks, max_d_idx, u32b *);
+        _dun_masks = NULL;
     }
+}
 
-    if (r_ptr->dungeon == dungeon_type) return TRUE; /* Accept associated monsters */
-    if (d_ptr->special_div >= 64) return TRUE;
-    if (summon_specific_type && !(d_ptr->flags1 & DF1_CHAMELEON)) return TRUE;
+bool mon_is_type(int r_idx, int type)
+{
+    _race_props_ptr props;
+
+    if (type < 0 || type > SUMMON_NAGA || _type_is_dynamic(type))
+        return _mon_is_type_aux(r_idx, type);
+
+    props = _race_props_get(r_idx);
+    return (props->types[type / 32] & (1U << (type % 32))) != 0;
+}
+
+
+static int chameleon_change_m_idx = 0;
+
+
+/*
+ * The static part of restrict_monster_to_dungeon(): the dungeon's mode
+ * applied to the race's flags and symbol.
+ */
+static bool _restrict_mode_aux(dungeon_info_type *d_ptr, monster_race *r_ptr)
+{
+    byte a;
 
     switch (d_ptr->mode)
     {
@@ -1379,16 +1529,6 @@ bool restrict_monster_to_dungeon(int r_idx, int which)
             if (d_ptr->r_char[a] == r_ptr->d_char)
                 return TRUE;
         }
-
-        /* Hack: Glass Castle uses MODE_OR and used to accept more monsters
-         * then just BR_LITE and BR_DARK (e.g. SELF_LITE, etc). Spells are
-         * no longer flags, so we need to hack things up ... */
-        if (dungeon_type == DUNGEON_GLASS)
-        {
-            if (r_idx == MON_CHAMELEON) return TRUE;
-            if (!mon_race_has_lite_dark_spell(r_ptr)) return FALSE;
-        }
-
         return FALSE;
 
     case DUNGEON_MODE_NOR:
@@ -1408,6 +1548,83 @@ bool restrict_monster_to_dungeon(int r_idx, int which)
     return TRUE;
 }
 
+/* The mode rules of a dungeon compiled to one bit per race. Dungeons
+ * whose rules test flags we toggle during play are left uncompiled. */
+static u32b *_dun_mask(int which)
+{
+    dungeon_info_type *d_ptr = &d_info[which];
+    u32b              *mask;
+    int                r_idx;
+
+    if ((d_ptr->mflags7 & RF7_GUARDIAN) || (d_ptr->mflagsr & RFR_PACT_MONSTER))
+        return NULL;
+
+    if (!_dun_masks)
+    {
+        C_MAKE(_dun_masks, max_d_idx, u32b *);
+        _dun_mask_words = (max_r_idx + 31) / 32;
+    }
+    mask = _dun_masks[which];
+    if (!mask)
+    {
+        C_MAKE(mask, _dun_mask_words, u32b);
+        for (r_idx = 0; r_idx < max_r_idx; r_idx++)
+        {
+            if (_restrict_mode_aux(d_ptr, &r_info[r_idx]))
+                mask[r_idx / 32] |= 1U << (r_idx % 32);
+        }
+        _dun_masks[which] = mask;
+    }
+    return mask;
+}
+
+/*
+ * Some dungeon types restrict the possible monsters.
+ * Return TRUE is the monster is OK and FALSE otherwise
+ */
+bool restrict_monster_to_dungeon(int r_idx, int which)
+{
+    dungeon_info_type *d_ptr = &d_info[which];
+    monster_race *r_ptr = &r_info[r_idx];
+    _race_props_ptr props = _race_props_get(r_idx);
+    u32b *mask;
+
+    if (d_ptr->flags1 & DF1_CHAMELEON)
+    {
+        if (chameleon_change_m_idx) return TRUE;
+    }
+    if (d_ptr->flags1 & DF1_NO_MAGIC)
+    {
+        if (r_idx != MON_CHAMELEON && !(props->flags & _RP_INNATE_SPELL))
+            return FALSE;
+    }                                                              /* v--- ...but prevent the Summon Mold exploit. Sigh ... */
+    if (d_ptr->flags1 & DF1_NO_MELEE && (summon_specific_who != -1 || !allow_pets))
+    {                                 /* ^---- Block players spamming the anti-melee cave for better summons... */
+        if (r_idx == MON_CHAMELEON) return TRUE;
+        if (!(props->flags & _RP_ATTACK_SPELL)) return FALSE;
+    }
+    if (d_ptr->flags1 & DF1_BEGINNER)
+    {
+        if (r_ptr->level > dun_level)
+            return FALSE;
+    }
+
+    if (r_ptr->dungeon == dungeon_type) return TRUE; /* Accept associated monsters */
+    if (d_ptr->special_div >= 64) return TRUE;
+    if (summon_specific_type && !(d_ptr->flags1 & DF1_CHAMELEON)) return TRUE;
+
+    /* Hack: Glass Castle uses MODE_OR and used to accept more monsters
+     * then just BR_LITE and BR_DARK (e.g. SELF_LITE, etc). Spells are
+     * no longer flags, so we need to hack things up ... The chameleon
+     * is the only race this lets through that the flags would not. */
+    if (d_ptr->mode == DUNGEON_MODE_OR && dungeon_type == DUNGEON_GLASS && r_idx == MON_CHAMELEON)
+        return TRUE;
+
+    mask = _dun_mask(which);
+    if (!mask) return _restrict_mode_aux(d_ptr, r_ptr);
+    return (mask[r_idx / 32] & (1U << (r_idx % 32))) != 0;
+}
+
 /*
  * Apply a "monster restriction function" to the "monster allocation table"
  */
@@ -2670,6 +2887,7 @@ void update_mon(int m_idx, bool full)
 
         /* Save the distance */
         m_ptr->cdis = d;
+        mon_hot_sync(m_idx);
 
         if (m_ptr->cdis <= 2 && projectable(py, px, fy, fx))
             do_disturb = TRUE;
@@ -2682,6 +2900,18 @@ void update_mon(int m_idx, bool full)
         d = m_ptr->cdis;
     }
 
+    /* Beyond sight, undetected and not currently shown: nothing below
+     * can make the monster visible, and there is nothing to hide. */
+    if ( d > MAX_SIGHT
+      && !(m_ptr->mflag2 & MFLAG2_MARK)
+      && !m_ptr->ml
+      && !(m_ptr->mflag & MFLAG_VIEW)
+      && !p_ptr->wizard )
+    {
+        m_ptr->mflag2 &= ~MFLAG2_FUZZY;
+        return;
+    }
+
 
     /* Detected */
     if (m_ptr->mflag2 & (MFLAG2_MARK)) flag = TRUE;
@@ -4470,7 +4700,7 @@ static bool summon_specific_okay(int r_idx)
         }
     }
 
-    if (!summon_summoner_okay && (mon_race_can_summon(r_ptr, -1))) return FALSE;
+    if (!summon_summoner_okay && (_race_props_get(r_idx)->flags & _RP_SUMMONER)) return FALSE;
 
     if (summon_friendly_unique_okay)
     {
@@ -4,14 +4,14 @@
 
 obj_ptr obj_alloc(void)
 {
-    obj_ptr obj = malloc(sizeof(object_type));
+    obj_ptr obj = slab_alloc(sizeof(object_type));
     object_wipe(obj);
     return obj;
 }
 
 obj_ptr obj_copy(obj_ptr obj)
 {
-    obj_ptr copy = malloc(sizeof(object_type));
+    obj_ptr copy = slab_alloc(sizeof(object_type));
     assert(obj);
     *copy = *obj;
     return copy;
@@ -69,7 +69,7 @@ void obj_free(obj_ptr obj)
     if (obj)
     {
         object_wipe(obj);
-        free(obj);
+        slab_free(obj, sizeof(object_type));
     }
 }
 
@@ -452,6 +452,7 @@ static void _obj_identify_aux(object_type *o_ptr)
     int i;
 
     k_info[o_ptr->k_idx].aware = TRUE;
+    object_desc_invalidate();
 
     o_ptr->feeling = FEEL_NONE;
     o_ptr->ident &= ~(IDENT_SENSE | IDENT_EMPTY | IDENT_TRIED);
@@ -525,6 +526,8 @@ static void _obj_identify_fully_aux(object_type *o_ptr)
 {
     int i;
 
+    object_desc_invalidate();
+
     if (o_ptr->name1)
     {
         artifact_type *a_ptr = &a_info[o_ptr->name1];
@@ -635,6 +638,7 @@ bool obj_learn_flag(object_type *o_ptr, int which)
         {
             if (have_flag(a_ptr->known_flags, which)) return FALSE;
             add_flag(a_ptr->known_flags, which);
+            object_desc_invalidate();
             return TRUE;
         }
         else if (have_flag(o_ptr->flags, which))
@@ -651,6 +655,7 @@ bool obj_learn_flag(object_type *o_ptr, int which)
         {
             if (have_flag(e_ptr->known_flags, which)) return FALSE;
             add_flag(e_ptr->known_flags, which);
+            object_desc_invalidate();
             return TRUE;
         }
         else if (have_flag(o_ptr->flags, which))
@@ -659,6 +664,7 @@ bool obj_learn_flag(object_type *o_ptr, int which)
             {
                 if (have_flag(e_ptr->known_flags, which)) return FALSE;
                 add_flag(e_ptr->known_flags, which);
+                object_desc_invalidate();
             }
             else
             {
@@ -692,6 +698,7 @@ void obj_learn_activation(object_type *o_ptr)
         return;
     }
 
+    object_desc_invalidate();
     if (o_ptr->activation.type)
     {
         add_flag(o_ptr->known_flags, OF_ACTIVATE);
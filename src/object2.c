@@ -141,7 +141,8 @@ void excise_object_idx(int o_idx)
     }
 
     if (j_ptr->insured) cornucopia_mark_destroyed(cornucopia_item_policy(j_ptr), j_ptr->number);
-    p_ptr->window |= PW_OBJECT_LIST;
+    if (j_ptr->marked & OM_FOUND)
+        p_ptr->window |= PW_OBJECT_LIST;
 }
 
 
@@ -178,8 +179,6 @@ void delete_object_idx(int o_idx)
 
     /* Count objects */
     o_cnt--;
-
-    p_ptr->window |= PW_OBJECT_LIST;
 }
 
 
@@ -192,6 +191,8 @@ void delete_object(int y, int x)
 
     s16b this_o_idx, next_o_idx = 0;
 
+    bool listed = FALSE;
+
 
     /* Refuse "illegal" locations */
     if (!in_bounds(y, x)) return;
@@ -211,6 +212,8 @@ void delete_object(int y, int x)
         /* Acquire next object */
         next_o_idx = o_ptr->next_o_idx;
 
+        if (o_ptr->marked & OM_FOUND) listed = TRUE;
+
         /* Tell Cornucopia not to track the item anymore */
         if (o_ptr->insured) cornucopia_mark_destroyed(cornucopia_item_policy(o_ptr), o_ptr->number);
 
@@ -227,7 +230,8 @@ void delete_object(int y, int x)
     /* Visual update */
     lite_spot(y, x);
 
-    p_ptr->window |= PW_OBJECT_LIST;
+    if (listed)
+        p_ptr->window |= PW_OBJECT_LIST;
 }
 
 
@@ -761,6 +765,7 @@ bool object_is_aware(object_type *o_ptr)
 void object_aware(object_type *o_ptr)
 {
     k_info[o_ptr->k_idx].aware = TRUE;
+    object_desc_invalidate();
 }
 /* Statistics
    We try hard not to leak information. For example, when picking up an
@@ -1103,7 +1108,10 @@ void object_tried(object_type *o_ptr)
     if (object_is_device(o_ptr))
         o_ptr->ident |= IDENT_TRIED;
     else
+    {
         k_info[o_ptr->k_idx].tried = TRUE;
+        object_desc_invalidate();
+    }
 }
 
 bool object_is_tried(object_type *o_ptr)
@@ -570,25 +570,9 @@ void py_throw_doc(py_throw_ptr context, doc_ptr doc)
 
     if (!have_flag(context->flags, OF_BRAND_ORDER))
     {
-        const int attempts = 10 * 1000;
-        int i;
-        int crits = 0;
-        /* Compute Average Effects of Criticals by sampling */
-        for (i = 0; i < attempts; i++)
-        {
-            critical_t tmp = critical_throw(context->obj->weight, context->obj->to_h);
-            if (tmp.desc)
-            {
-                crit.mul += tmp.mul;
-                crit.to_d += tmp.to_d;
-                crits++;
-            }
-            else
-                crit.mul += 100;
-        }
-        crit.mul = crit.mul / attempts;
-        crit.to_d = crit.to_d * 100 / attempts;
-        crit_pct = crits * 1000 / attempts;
+        critical_odds_t odds = critical_throw_odds(context->obj->weight, context->obj->to_h);
+        crit.mul = critical_avg_mul(odds);
+        crit_pct = critical_pct(odds);
     }
     else
         crit.mul = 100;
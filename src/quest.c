@@ -31,6 +31,7 @@ void quest_free(quest_ptr q)
     {
         free((vptr)q->name);
         if (q->file) free((vptr)q->file);
+        if (q->lines) vec_free(q->lines);
         free(q);
     }
 }
@@ -41,6 +42,11 @@ void quest_change_file(quest_ptr q, cptr file)
     if (q->file) free((vptr)q->file);
     if (file) q->file = _strcpy(file);
     else q->file = NULL;
+    if (q->lines)
+    {
+        vec_free(q->lines);
+        q->lines = NULL;
+    }
 }
 
 cptr kayttonimi(quest_ptr q)
@@ -333,6 +339,20 @@ void quest_fail(quest_ptr q)
 /************************************************************************
  * Quest Info from q->file
  ***********************************************************************/
+/* Quest files are consulted often (quest screens, rewards, entering the
+ * quest level), so keep their contents around rather than re-reading them
+ * from disk each time. */
+static errr _parse_file(quest_ptr q, parser_f parser, int options)
+{
+    assert(q->file);
+    if (!q->lines)
+    {
+        q->lines = load_edit_file(q->file);
+        if (!q->lines) return -1;
+    }
+    return parse_edit_lines(q->file, q->lines, parser, options);
+}
+
 static string_ptr _temp_desc;
 static errr _parse_desc(char *line, int options)
 {
@@ -350,7 +370,7 @@ string_ptr quest_get_description(quest_ptr q)
     if (q->file)
     {
         _temp_desc = s;
-        parse_edit_file(q->file, _parse_desc, 0);
+        _parse_file(q, _parse_desc, 0);
         _temp_desc = NULL;
     }
     return s;
@@ -377,7 +397,7 @@ obj_ptr quest_get_reward(quest_ptr q)
         room_grid_ptr letter = malloc(sizeof(room_grid_t));
         memset(letter, 0, sizeof(room_grid_t));
         _temp_reward = letter;
-        if (parse_edit_file(q->file, _parse_reward, 0) == ERROR_SUCCESS)
+        if (_parse_file(q, _parse_reward, 0) == ERROR_SUCCESS)
         {
             if (!letter->object_level)
                 letter->object_level = 1; /* Hack: force at least AM_GOOD */
@@ -422,7 +442,7 @@ room_ptr quest_get_map(quest_ptr q)
     {
         room_ptr room = room_alloc(q->name);
         _temp_room = room;
-        if (parse_edit_file(q->file, _parse_room, 0) != ERROR_SUCCESS)
+        if (_parse_file(q, _parse_room, 0) != ERROR_SUCCESS)
         {
             room_free(room);
             room = NULL;
@@ -811,7 +831,7 @@ quest_ptr _quest_map_find(int which)
     {
         _substitute_hack = 0;
         _lukko = TRUE;
-        if ((parse_edit_file(q->file, _parse_substitute, 0) != ERROR_SUCCESS) || (!_substitute_hack))
+        if ((_parse_file(q, _parse_substitute, 0) != ERROR_SUCCESS) || (!_substitute_hack))
         {
             q->substitute = 0;
             _lukko = FALSE;
@@ -2405,7 +2425,7 @@ static void _analyze_cmd(_ui_context_ptr context)
             memset(_temp_reward, 0, sizeof(room_grid_t));
             trace_doc = context->doc;
             doc_clear(context->doc);
-            parse_edit_file(quest->file, _parse_debug, INIT_DEBUG);
+            _parse_file(quest, _parse_debug, INIT_DEBUG);
             room_free(_temp_room);
             free(_temp_reward);
             _temp_room = NULL;
@@ -60,6 +60,8 @@ struct quest_s
     u32b completed_turn;
 
     u32b seed;        /* For $RANDOM_ in quest files */
+
+    vec_ptr lines;    /* Contents of file, loaded on first use (see _parse_file) */
 };
 typedef struct quest_s quest_t, *quest_ptr;
 typedef void (*quest_f)(quest_ptr q);
@@ -80,7 +82,8 @@ extern void       quest_fail(quest_ptr q);
 extern string_ptr quest_get_description(quest_ptr q); /* read q->file for D: lines */
 extern obj_ptr    quest_get_reward(quest_ptr q); /* read q->file for R: line and create object */
 extern room_ptr   quest_get_map(quest_ptr q); /* QF_GENERATE: read q->file for the level map (M: lines) */
-                  /* Note: fetching info from a q_*.txt file always allocates new memory, which *you* must delete */
+                  /* Note: fetching info from a q_*.txt file always allocates new memory, which *you* must delete.
+                     The file itself is only read once; ?: conditionals are still evaluated on each fetch. */
 
 extern void       quest_generate(quest_ptr q); /* QF_GENERATE: quest_gen() */
 extern bool       quest_post_generate(quest_ptr q); /* place quest monsters */
@@ -274,33 +274,132 @@ static FILE *_scores_fopen(cptr name, cptr mode)
     return my_fopen(buf, mode);
 }
 
+/* scores.txt holds one line per character, sorted by score_cmp. We keep the
+ * parsed records in memory and remember which version of the file they came
+ * from, so scores_load() only reparses after someone (possibly another
+ * process on a shared server) has rewritten the file. The file is identified
+ * by device, inode, size and mtime. Since mtime only has one second
+ * resolution, a file modified in the same second we looked at it is never
+ * trusted: it might still change without its stamp changing. */
+static vec_ptr     _scores = NULL;     /* parsed records, owned and sorted */
+static int_map_ptr _score_ids = NULL;  /* id -> record in _scores[] */
+static bool        _scores_valid = FALSE;
+#ifdef HAVE_STAT
+static struct stat _scores_stat;       /* scores.txt when last parsed */
+static time_t      _scores_seen;       /* when _scores_stat was taken */
+#endif
+
+static void _scores_reset(void)
+{
+    if (!_scores)
+    {
+        _scores = vec_alloc((vec_free_f)score_free);
+        _score_ids = int_map_alloc(NULL);
+    }
+    else
+    {
+        int_map_clear(_score_ids);
+        vec_clear(_scores);
+    }
+    _scores_valid = FALSE;
+}
+
+static void _scores_stamp(void)
+{
+#ifdef HAVE_STAT
+    char buf[1024];
+    path_build(buf, sizeof(buf), ANGBAND_DIR_APEX, "scores.txt");
+    _scores_seen = time(NULL);
+    _scores_valid = stat(buf, &_scores_stat) == 0;
+#else
+    _scores_valid = FALSE;
+#endif
+}
+
+static bool _scores_unchanged(void)
+{
+#ifdef HAVE_STAT
+    char        buf[1024];
+    struct stat st;
+
+    if (!_scores_valid) return FALSE;
+    path_build(buf, sizeof(buf), ANGBAND_DIR_APEX, "scores.txt");
+    if (stat(buf, &st) != 0) return FALSE;
+    return st.st_dev == _scores_stat.st_dev
+        && st.st_ino == _scores_stat.st_ino
+        && st.st_size == _scores_stat.st_size
+        && st.st_mtime == _scores_stat.st_mtime
+        && st.st_mtime < _scores_seen;
+#else
+    return FALSE;
+#endif
+}
+
+static void _scores_add(score_ptr score)
+{
+    score_ptr old = int_map_find(_score_ids, score->id);
+    if (old)
+    {
+        /* Update in place so the record keeps its address */
+        score_t tmp = *old;
+        *old = *score;
+        *score = tmp;
+        score_free(score);
+    }
+    else
+    {
+        vec_add(_scores, score);
+        int_map_add(_score_ids, score->id, score);
+    }
+}
+
+static void _scores_sync(void)
+{
+    FILE *fp;
+
+    if (_scores_unchanged()) return;
+    _scores_reset();
+
+    fp = _scores_fopen("scores.txt", "r");
+    if (!fp) return;
+    _scores_stamp();
+    for (;;)
+    {
+        score_ptr score = score_read(fp);
+        if (!score) break;
+        _scores_add(score);
+    }
+    fclose(fp);
+    vec_sort(_scores, (vec_cmp_f)score_cmp);
+}
+
+static void _scores_write(vec_ptr scores, FILE *fp)
+{
+    int i;
+    for (i = 0; i < vec_length(scores); i++)
+    {
+        score_ptr score = vec_get(scores, i);
+        score_write(score, fp);
+    }
+}
+
 vec_ptr scores_load(score_p filter)
 {
-    FILE   *fp = _scores_fopen("scores.txt", "r");
-    vec_ptr v = vec_alloc((vec_free_f)score_free);
+    vec_ptr v = vec_alloc(NULL);
+    int     i;
 
-    if (fp)
+    _scores_sync();
+    for (i = 0; i < vec_length(_scores); i++)
     {
-        for (;;)
-        {
-            score_ptr score = score_read(fp);
-            if (!score) break;
-            if (filter && !filter(score))
-            {
-                score_free(score);
-                continue;
-            }
-            vec_add(v, score);
-        }
-        fclose(fp);
+        score_ptr score = vec_get(_scores, i);
+        if (filter && !filter(score)) continue;
+        vec_add(v, score);
     }
-    vec_sort(v, (vec_cmp_f)score_cmp);
-    return v;
+    return v; /* already sorted by score_cmp */
 }
 
 void scores_save(vec_ptr scores)
 {
-    int i;
     FILE *fp = _scores_fopen("scores.txt", "w");
 
     if (!fp)
@@ -309,12 +408,11 @@ void scores_save(vec_ptr scores)
         return;
     }
     vec_sort(scores, (vec_cmp_f)score_cmp);
-    for (i = 0; i < vec_length(scores); i++)
-    {
-        score_ptr score = vec_get(scores, i);
-        score_write(score, fp);
-    }
+    _scores_write(scores, fp);
     fclose(fp);
+
+    /* scores[] may share records with our cache, so reparse on next use */
+    _scores_valid = FALSE;
 }
 
 int scores_next_id(void)
@@ -345,33 +443,35 @@ int scores_next_id(void)
 
 void scores_update(void)
 {
-    int       i;
-    vec_ptr   scores = scores_load(NULL);
     score_ptr current = score_current();
     FILE     *fp;
     char      name[100];
 
-    for (i = 0; i < vec_length(scores); i++)
+    _scores_sync();
+    _scores_add(current);
+    vec_sort(_scores, (vec_cmp_f)score_cmp);
+
+    fp = _scores_fopen("scores.txt", "w");
+    if (fp)
     {
-        score_ptr score = vec_get(scores, i);
-        if (score->id == current->id)
-        {
-            vec_set(scores, i, current);
-            break;
-        }
+        _scores_write(_scores, fp);
+        fclose(fp);
+        _scores_stamp();
+    }
+    else
+    {
+        msg_print("<color:v>Error:</color> Unable to open scores.txt");
+        _scores_valid = FALSE;
     }
-    if (i == vec_length(scores))
-        vec_add(scores, current);
-    scores_save(scores);
-    vec_free(scores); /* current is now in scores[] and need not be freed */
 
     sprintf(name, "dump%d.doc", p_ptr->id);
     fp = _scores_fopen(name, "w");
     if (fp)
     {
         doc_ptr doc = doc_alloc(80);
+        doc_begin_stream(doc, fp, DOC_FORMAT_DOC);
         py_display_character_sheet(doc);
-        doc_write_file(doc, fp, DOC_FORMAT_DOC);
+        doc_end_stream(doc);
         doc_free(doc);
         fclose(fp);
     } 
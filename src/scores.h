@@ -31,6 +31,9 @@ typedef struct {
 } score_t, *score_ptr;
 typedef bool (*score_p)(score_ptr score);
 
+/* scores_load() returns a sorted view of the scores cached in memory: free
+ * it with vec_free(), but do not free the scores themselves, nor keep them
+ * past the next call to scores_load(), scores_save() or scores_update(). */
 extern vec_ptr   scores_load(score_p filter);
 extern void      scores_save(vec_ptr scores);
 extern void      scores_display(vec_ptr scores);
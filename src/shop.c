@@ -419,9 +419,48 @@ static bool _stock_p(int k_idx)
     return TRUE;
 }
 
+/* get_obj_num_prep() walks the whole allocation table, and _get_k_idx()
+ * used to do it twice for every object rolled. While restocking we leave
+ * the table prepared for the last hook (most shops only ever use one) and
+ * restore it once at the end with _get_k_idx_end(). */
+static bool     _k_idx_batch = FALSE;
+static _k_idx_p _k_idx_prepared = NULL;
+
+static void _get_k_idx_begin(void)
+{
+    assert(!_k_idx_batch);
+    _k_idx_batch = TRUE;
+    _k_idx_prepared = NULL;
+}
+
+static void _get_k_idx_end(void)
+{
+    assert(_k_idx_batch);
+    _k_idx_batch = FALSE;
+    if (_k_idx_prepared)
+    {
+        get_obj_num_hook = NULL;
+        get_obj_num_prep();
+        _k_idx_prepared = NULL;
+    }
+}
+
 static int _get_k_idx(_k_idx_p p, int lvl)
 {
     int k_idx;
+    if (_k_idx_batch)
+    {
+        /* The black market passes in the hook choose_obj_kind() just set;
+         * those read state set by choose_obj_kind(), so always prepare */
+        if (p != _k_idx_prepared || (p && p == get_obj_num_hook))
+        {
+            get_obj_num_hook = p;
+            get_obj_num_prep();
+            _k_idx_prepared = p;
+        }
+        get_obj_num_hook = NULL;
+        return get_obj_num(lvl);
+    }
     if (p)
     {
         get_obj_num_hook = p;
@@ -2112,24 +2151,9 @@ static int _stock_base(shop_ptr shop)
     return _STOCK_BASE - 4 + randint1(8);
 }
 
-static void _maintain(shop_ptr shop)
+/* Limit shop scumming (ie resting in town or on DL1 for BM wares) */
+static bool _allow_restock(shop_ptr shop)
 {
-    int  num;
-    int  i;
-    bool allow_restock = TRUE;
-
-    /* Always initialize an empty shop */
-    if (!inv_count_slots(shop->inv, obj_exists))
-    {
-        _restock(shop, _stock_base(shop), FALSE);
-        return;
-    }
-
-    /* Shops maintain once per day */
-    num = MIN(10, (game_turn - shop->last_restock.turn) / TOWN_DAWN);
-    if (!num) return;
-
-    /* Limit shop scumming (ie resting in town or on DL1 for BM wares) */
     if (!_shop_is_basic(shop))
     {
         if (shop->last_restock.turn)
@@ -2141,10 +2165,36 @@ static void _maintain(shop_ptr shop)
               && p_ptr->max_exp <= xp
               && p_ptr->prace != RACE_ANDROID )
             {
-                allow_restock = FALSE;
+                return FALSE;
             }
         }
     }
+    return TRUE;
+}
+
+static int _maintain_days(shop_ptr shop)
+{
+    /* Shops maintain once per day */
+    return MIN(10, (game_turn - shop->last_restock.turn) / TOWN_DAWN);
+}
+
+static void _maintain(shop_ptr shop)
+{
+    int  num;
+    int  i;
+    bool allow_restock;
+
+    /* Always initialize an empty shop */
+    if (!inv_count_slots(shop->inv, obj_exists))
+    {
+        _restock(shop, _stock_base(shop), FALSE);
+        return;
+    }
+
+    num = _maintain_days(shop);
+    if (!num) return;
+
+    allow_restock = _allow_restock(shop);
 
     /* Maintain the shop for each day since last visit */
     for (i = 0; i < num; i++)
@@ -2262,6 +2312,7 @@ static int _restock(shop_ptr shop, int target, bool is_shuffle)
     if (ct > target) return ct; /* Too many reserved items... */
 
     assert(ct <= target);
+    _get_k_idx_begin();
     for (attempt = 1; ct < target && attempt < 100; attempt++)
     {
         obj_t forge = {0};
@@ -2271,6 +2322,7 @@ static int _restock(shop_ptr shop, int target, bool is_shuffle)
             ct += _add_obj(shop, &forge, TRUE);
         }
     }
+    _get_k_idx_end();
     inv_sort(shop->inv);
     assert(ct == inv_count_slots(shop->inv, obj_exists));
     shop->last_restock.turn = game_turn;
@@ -2653,6 +2705,37 @@ void towns_on_turn_overflow(int rollback_turns)
     }
 }
 
+/* Called each game tick while the player is in town: bring at most one
+ * shop up to date so that walking in the door of a shop left alone for
+ * days does not pay for all of them at once. Only shops that will
+ * actually restock are handled here; the anti-scumming culls for shops
+ * that won't still happen on entry, as before. */
+void towns_maintain_shops(void)
+{
+    town_ptr         town = towns_current_town();
+    int_map_iter_ptr iter;
+
+    for (iter = int_map_iter_alloc(town->shops);
+            int_map_iter_is_valid(iter);
+            int_map_iter_next(iter))
+    {
+        shop_ptr shop = int_map_iter_current(iter);
+
+        if (shop->type->id == SHOP_HOME || shop->type->id == SHOP_MUSEUM) continue;
+        if (!_maintain_days(shop) || !_allow_restock(shop)) continue;
+
+        store_hack = TRUE;
+        _maintain(shop);
+        store_hack = FALSE;
+
+        /* Paranoia: a shop over _STOCK_HI is only culled, so don't
+         * come back for it every tick */
+        shop->last_restock.turn = game_turn;
+        break;
+    }
+    int_map_iter_free(iter);
+}
+
 void _town_add_shop_item(town_ptr town, int which, int k_idx, int ct)
 {
     shop_ptr shop = town_get_shop(town, which);
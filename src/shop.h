@@ -75,6 +75,7 @@ extern town_ptr towns_get_town(int which);
 extern void     towns_save(savefile_ptr file);
 extern void     towns_load(savefile_ptr file);
 extern void     towns_on_turn_overflow(int rollback_turns);
+extern void     towns_maintain_shops(void);
 
 extern void     towns_init_buildings(void);
 extern room_ptr towns_get_map(void);
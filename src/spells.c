@@ -314,6 +314,88 @@ cptr get_spell_spoiler_name(ang_spell spell)
     return buf;
 }
 
+/****************************************************************************************
+ * Menu Memo
+ *   The spell menus redraw every row on each keypress, and each row calls the spell's
+ *   name, info and color handlers (formatting damage strings and the like). Nothing
+ *   these depend on changes while a menu is up, so the results are remembered for the
+ *   current game turn. calc_bonuses() forgets them for changes that do not take a turn.
+ ****************************************************************************************/
+#define _MEMO_SIZE 256 /* power of 2 */
+typedef struct {
+    ang_spell fn;
+    char      name[64];
+    char      info[80];
+    byte      color;
+} _spell_memo_t, *_spell_memo_ptr;
+
+static _spell_memo_t _spell_memo[_MEMO_SIZE];
+static char          _realm_memo[MAX_REALM + 1][32][80];
+static u32b          _realm_memo_valid[MAX_REALM + 1];
+static s32b          _memo_turn = -1;
+
+void spell_memo_invalidate(void)
+{
+    _memo_turn = -1;
+}
+
+static void _memo_sync(void)
+{
+    if (_memo_turn != game_turn)
+    {
+        int i;
+        for (i = 0; i < _MEMO_SIZE; i++)
+            _spell_memo[i].fn = NULL;
+        for (i = 0; i <= MAX_REALM; i++)
+            _realm_memo_valid[i] = 0;
+        _memo_turn = game_turn;
+    }
+}
+
+static _spell_memo_ptr _spell_memo_get(ang_spell spell)
+{
+    int i, j;
+    _spell_memo_ptr memo;
+    variant v;
+
+    _memo_sync();
+    i = ((size_t)spell >> 4) & (_MEMO_SIZE - 1);
+    for (j = 0; j < _MEMO_SIZE; j++)
+    {
+        memo = &_spell_memo[(i + j) & (_MEMO_SIZE - 1)];
+        if (memo->fn == spell) return memo;
+        if (!memo->fn) break;
+    }
+    if (j == _MEMO_SIZE) /* full: recycle the home slot */
+        memo = &_spell_memo[i];
+
+    var_init(&v);
+    spell(SPELL_NAME, &v);
+    my_strcpy(memo->name, var_get_string(&v), sizeof(memo->name));
+    spell(SPELL_INFO, &v);
+    my_strcpy(memo->info, var_get_string(&v), sizeof(memo->info));
+    var_set_int(&v, TERM_WHITE);
+    spell(SPELL_COLOR, &v);
+    memo->color = var_get_int(&v);
+    var_clear(&v);
+
+    memo->fn = spell;
+    return memo;
+}
+
+cptr get_realm_spell_info(int realm, int spell)
+{
+    _memo_sync();
+    if (realm < 0 || realm > MAX_REALM || spell < 0 || spell >= 32)
+        return do_spell(realm, spell, SPELL_INFO);
+    if (!(_realm_memo_valid[realm] & (1U << spell)))
+    {
+        my_strcpy(_realm_memo[realm][spell], do_spell(realm, spell, SPELL_INFO), 80);
+        _realm_memo_valid[realm] |= 1U << spell;
+    }
+    return _realm_memo[realm][spell];
+}
+
 /****************************************************************************************
  * UI Utilities
  *   choose_spell - prompt user with a list of spells, they choose one.
@@ -341,15 +423,10 @@ static void _list_spells(power_info* spells, int ct, int max_cost, char *labels,
     rect_t display = ui_menu_rect();
     int  col_height = _col_height(ct);
     int  col_width;
-    variant name, info, color;
     bool poli = (p_ptr->pclass == CLASS_POLITICIAN);
     bool show_stats = (power || p_ptr->pclass == CLASS_WILD_TALENT);
     byte skipped = 0;
 
-    var_init(&name);
-    var_init(&info);
-    var_init(&color);
-
     if (power) poli = FALSE;
 
     if (rage_hack)
@@ -385,6 +462,7 @@ static void _list_spells(power_info* spells, int ct, int max_cost, char *labels,
         byte attr = TERM_WHITE;
         spell_info* spell = &spells[i].spell;
         int spell_cost = spell->cost;
+        _spell_memo_ptr memo;
 
         if ((rage_hack) && (spell->level == 99))
         {
@@ -392,13 +470,8 @@ static void _list_spells(power_info* spells, int ct, int max_cost, char *labels,
             continue;
         }
 
-        var_set_int(&color, TERM_WHITE);
-
-        (spell->fn)(SPELL_NAME, &name);
-        (spell->fn)(SPELL_INFO, &info);
-        (spell->fn)(SPELL_COLOR, &color);
-
-        attr = var_get_int(&color);
+        memo = _spell_memo_get(spell->fn);
+        attr = memo->color;
 
         if ((labels) && (i < (int)strlen(labels))) letter = labels[i];
         else if (i < 26)
@@ -413,7 +486,7 @@ static void _list_spells(power_info* spells, int ct, int max_cost, char *labels,
         if (!poli)
         {
             strcat(temp, format("%-23.23s %3d %4d %3d%%",
-                            var_get_string(&name),
+                            memo->name,
                             spell->level,
                             spell->cost,
                             spell->fail));
@@ -424,7 +497,7 @@ static void _list_spells(power_info* spells, int ct, int max_cost, char *labels,
             spell_cost = politician_get_cost(spell);
             big_num_display(spell_cost, temp2);
             strcat(temp, format("%-23.23s %3d %6s %5d%%",
-                            var_get_string(&name),
+                            memo->name,
                             spell->level,
                             temp2,
                             spell->fail));
@@ -438,7 +511,7 @@ static void _list_spells(power_info* spells, int ct, int max_cost, char *labels,
         }
 
         if ((col_height == ct) && (spell->level <= p_ptr->lev))
-            strcat(temp, format(" %s", var_get_string(&info)));
+            strcat(temp, format(" %s", memo->info));
 
         if (spell->fail == 100)
             attr = TERM_L_DARK;
@@ -460,9 +533,6 @@ static void _list_spells(power_info* spells, int ct, int max_cost, char *labels,
         }
     }
     Term_erase(display.x, display.y + col_height + 1 - skipped, display.cx);
-    var_clear(&name);
-    var_clear(&info);
-    var_clear(&color);
 }
 
 static bool _describe_spell(spell_info *spell, int col_height)
@@ -495,10 +565,7 @@ static bool _describe_spell(spell_info *spell, int col_height)
         }
 
         if (spell->level <= p_ptr->lev)
-        {
-            (spell->fn)(SPELL_INFO, &info);
-            put_str(format("%^s", var_get_string(&info)), line, display.x + 2);
-        }
+            put_str(format("%^s", _spell_memo_get(spell->fn)->info), line, display.x + 2);
         result = FALSE;
     }
     var_clear(&info);
@@ -1543,7 +1610,7 @@ static void _dump_book(doc_ptr doc, int realm, int book)
             proficiency[4] = '\0';
         }
 
-        strcpy(info, do_spell(realm, s_idx, SPELL_INFO));
+        strcpy(info, get_realm_spell_info(realm, s_idx));
         comment = info;
 
         if (p_ptr->pclass == CLASS_SORCERER || p_ptr->pclass == CLASS_RED_MAGE)
@@ -21,6 +21,8 @@ extern cptr get_spell_name(ang_spell spell); /* buffer reset on each call */
 extern cptr get_spell_stat_name(ang_spell spell); /* buffer reset on each call */
 extern cptr get_spell_desc(ang_spell spell); /* buffer reset on each call */
 extern cptr get_spell_spoiler_name(ang_spell spell); /* buffer reset on each call */
+extern cptr get_realm_spell_info(int realm, int spell); /* memoized do_spell(SPELL_INFO) */
+extern void spell_memo_invalidate(void);
 extern void spell_stats_on_birth(void);
 extern void spell_stats_on_load(savefile_ptr file);
 extern void spell_stats_on_save(savefile_ptr file);
@@ -2424,6 +2424,42 @@ bool in_disintegration_range(int y1, int x1, int y2, int x2)
 }
 
 
+/*
+ * Blast rings: the offsets at exactly distance() d from a center, in the
+ * same row-major order the blast scans below used to visit them. distance()
+ * only depends on |dy| and |dx|, so these are computed once rather than
+ * scanning the whole (2d+1)x(2d+1) square for every ring of every blast.
+ */
+#define _RING_MAX 63 /* gm[] in project() holds radii up to 62 */
+static s16b  _ring_start[_RING_MAX + 2];
+static s16b *_ring_y = NULL;
+static s16b *_ring_x = NULL;
+
+static void _ring_init(void)
+{
+    int d, y, x, n = 0;
+    int max = (2 * _RING_MAX + 1) * (2 * _RING_MAX + 1);
+
+    _ring_y = malloc(max * sizeof(s16b));
+    _ring_x = malloc(max * sizeof(s16b));
+
+    for (d = 0; d <= _RING_MAX; d++)
+    {
+        _ring_start[d] = n;
+        for (y = -d; y <= d; y++)
+        {
+            for (x = -d; x <= d; x++)
+            {
+                if (distance(0, 0, y, x) != d) continue;
+                _ring_y[n] = y;
+                _ring_x[n] = x;
+                n++;
+            }
+        }
+    }
+    _ring_start[_RING_MAX + 1] = n;
+}
+
 /*
  * breath shape
  */
@@ -2438,6 +2474,9 @@ void breath_shape(u16b *path_g, int dist, int *pgrids, byte *gx, byte *gy, byte
     int path_n = 0;
     int mdis = distance(y1, x1, y2, x2) + rad;
 
+    if (!_ring_y) _ring_init();
+    assert(rad <= _RING_MAX);
+
     while (bdis <= mdis)
     {
         int x, y;
@@ -2460,42 +2499,41 @@ void breath_shape(u16b *path_g, int dist, int *pgrids, byte *gx, byte *gy, byte
         /* Travel from center outward */
         for (cdis = 0; cdis <= brad; cdis++)
         {
-            /* Scan the maximal blast area of radius "cdis" */
-            for (y = by - cdis; y <= by + cdis; y++)
-            {
-                for (x = bx - cdis; x <= bx + cdis; x++)
-                {
-                    /* Ignore "illegal" locations */
-                    if (!in_bounds(y, x)) continue;
+            int i;
 
-                    /* Enforce a circular "ripple" */
-                    if (distance(y1, x1, y, x) != bdis) continue;
+            /* Scan the grids at exactly "cdis" (this enforces an arc) */
+            for (i = _ring_start[cdis]; i < _ring_start[cdis + 1]; i++)
+            {
+                y = by + _ring_y[i];
+                x = bx + _ring_x[i];
 
-                    /* Enforce an arc */
-                    if (distance(by, bx, y, x) != cdis) continue;
+                /* Ignore "illegal" locations */
+                if (!in_bounds(y, x)) continue;
 
-                    switch (typ)
-                    {
-                    case GF_LITE:
-                    case GF_LITE_WEAK:
-                        /* Lights are stopped by opaque terrains */
-                        if (!los(by, bx, y, x)) continue;
-                        break;
-                    case GF_DISINTEGRATE:
-                        /* Disintegration are stopped only by perma-walls */
-                        if (!in_disintegration_range(by, bx, y, x)) continue;
-                        break;
-                    default:
-                        /* Ball explosions are stopped by walls */
-                        if (!projectable(by, bx, y, x)) continue;
-                        break;
-                    }
+                /* Enforce a circular "ripple" */
+                if (distance(y1, x1, y, x) != bdis) continue;
 
-                    /* Save this grid */
-                    gy[*pgrids] = y;
-                    gx[*pgrids] = x;
-                    (*pgrids)++;
+                switch (typ)
+                {
+                case GF_LITE:
+                case GF_LITE_WEAK:
+                    /* Lights are stopped by opaque terrains */
+                    if (!los(by, bx, y, x)) continue;
+                    break;
+                case GF_DISINTEGRATE:
+                    /* Disintegration are stopped only by perma-walls */
+                    if (!in_disintegration_range(by, bx, y, x)) continue;
+                    break;
+                default:
+                    /* Ball explosions are stopped by walls */
+                    if (!projectable(by, bx, y, x)) continue;
+                    break;
                 }
+
+                /* Save this grid */
+                gy[*pgrids] = y;
+                gx[*pgrids] = x;
+                (*pgrids)++;
             }
         }
 
@@ -3262,42 +3300,42 @@ bool project(int who, int rad, int y, int x, int dam, int typ, int flg)
         }
         else
         {
+            if (!_ring_y) _ring_init();
+            assert(rad <= _RING_MAX);
+
             /* Determine the blast area, work from the inside out */
             for (dist = 0; dist <= rad; dist++)
             {
-                /* Scan the maximal blast area of radius "dist" */
-                for (y = by - dist; y <= by + dist; y++)
+                /* Scan the grids at exactly "dist" (a "circular" explosion) */
+                for (i = _ring_start[dist]; i < _ring_start[dist + 1]; i++)
                 {
-                    for (x = bx - dist; x <= bx + dist; x++)
-                    {
-                        /* Ignore "illegal" locations */
-                        if (!in_bounds2(y, x)) continue;
-
-                        /* Enforce a "circular" explosion */
-                        if (distance(by, bx, y, x) != dist) continue;
+                    y = by + _ring_y[i];
+                    x = bx + _ring_x[i];
 
-                        switch (typ)
-                        {
-                        case GF_LITE:
-                        case GF_LITE_WEAK:
-                            /* Lights are stopped by opaque terrains */
-                            if (!los(by, bx, y, x)) continue;
-                            break;
-                        case GF_DISINTEGRATE:
-                            /* Disintegration are stopped only by perma-walls */
-                            if (!in_disintegration_range(by, bx, y, x)) continue;
-                            break;
-                        default:
-                            /* Ball explosions are stopped by walls */
-                            if (!projectable(by, bx, y, x)) continue;
-                            break;
-                        }
+                    /* Ignore "illegal" locations */
+                    if (!in_bounds2(y, x)) continue;
 
-                        /* Save this grid */
-                        gy[grids] = y;
-                        gx[grids] = x;
-                        grids++;
+                    switch (typ)
+                    {
+                    case GF_LITE:
+                    case GF_LITE_WEAK:
+                        /* Lights are stopped by opaque terrains */
+                        if (!los(by, bx, y, x)) continue;
+                        break;
+                    case GF_DISINTEGRATE:
+                        /* Disintegration are stopped only by perma-walls */
+                        if (!in_disintegration_range(by, bx, y, x)) continue;
+                        break;
+                    default:
+                        /* Ball explosions are stopped by walls */
+                        if (!projectable(by, bx, y, x)) continue;
+                        break;
                     }
+
+                    /* Save this grid */
+                    gy[grids] = y;
+                    gx[grids] = x;
+                    grids++;
                 }
 
                 /* Encode some more "radius" info */
@@ -3592,7 +3592,7 @@ void print_spells(int target_spell, byte *spells, int num, rect_t display, int u
         /* XXX XXX Could label spells above the players level */
 
         /* Get extra info */
-        strcpy(info, do_spell(use_realm, spell, SPELL_INFO));
+        strcpy(info, get_realm_spell_info(use_realm, spell));
 
         /* Use that info */
         comment = info;
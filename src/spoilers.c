@@ -4,6 +4,78 @@ bool spoiler_hack = FALSE;
 
 #ifdef ALLOW_SPOILERS
 
+/* Spoilers are written to <path>.new and only moved over <path> when the
+ * contents differ, so regenerating leaves unchanged files (and their
+ * timestamps) alone. */
+FILE *spoiler_fopen(cptr path)
+{
+    char buf[1024];
+    strnfmt(buf, sizeof(buf), "%s.new", path);
+    return my_fopen(buf, "w");
+}
+
+static bool _same_contents(cptr path1, cptr path2)
+{
+    FILE *fp1 = my_fopen(path1, "rb");
+    FILE *fp2 = my_fopen(path2, "rb");
+    bool  result = FALSE;
+
+    if (fp1 && fp2)
+    {
+        char buf1[4096], buf2[4096];
+        for (;;)
+        {
+            size_t n1 = fread(buf1, 1, sizeof(buf1), fp1);
+            size_t n2 = fread(buf2, 1, sizeof(buf2), fp2);
+            if (n1 != n2 || memcmp(buf1, buf2, n1) != 0) break;
+            if (!n1)
+            {
+                result = TRUE;
+                break;
+            }
+        }
+    }
+    if (fp1) my_fclose(fp1);
+    if (fp2) my_fclose(fp2);
+    return result;
+}
+
+/* Close a spoiler_fopen() file without touching path, e.g. after a write
+ * error, and remove the partial <path>.new */
+void spoiler_fabort(FILE *fp, cptr path)
+{
+    char buf[1024];
+
+    strnfmt(buf, sizeof(buf), "%s.new", path);
+    my_fclose(fp);
+    fd_kill(buf);
+}
+
+/* Returns TRUE if path was (re)written. A file with write errors is
+ * discarded, leaving path as it was. */
+bool spoiler_fclose(FILE *fp, cptr path)
+{
+    char buf[1024];
+
+    if (ferror(fp))
+    {
+        spoiler_fabort(fp, path);
+        return FALSE;
+    }
+
+    strnfmt(buf, sizeof(buf), "%s.new", path);
+    my_fclose(fp);
+
+    if (_same_contents(buf, path))
+    {
+        fd_kill(buf);
+        return FALSE;
+    }
+    fd_kill(path);
+    fd_move(buf, path);
+    return TRUE;
+}
+
 typedef void(*_file_fn)(FILE*);
 static void _help_file(cptr name, _file_fn fn)
 {
@@ -11,12 +83,12 @@ static void _help_file(cptr name, _file_fn fn)
     char    buf[1024];
 
     path_build(buf, sizeof(buf), ANGBAND_DIR_HELP, name);
-    fp = my_fopen(buf, "w");
+    fp = spoiler_fopen(buf);
 
     if (!fp)
     {
         path_build(buf, sizeof(buf), ANGBAND_DIR_USER, name);
-        fp = my_fopen(buf, "w");
+        fp = spoiler_fopen(buf);
 
         if (!fp)
         {
@@ -30,8 +102,7 @@ static void _help_file(cptr name, _file_fn fn)
     fprintf(fp, "\n\n<color:s>Automatically generated for FrogComposband %d.%d.%s.</color>\n",
             VER_MAJOR, VER_MINOR, VER_PATCH);
 
-    my_fclose(fp);
-    if (character_dungeon) msg_format("Created %s", buf);
+    if (spoiler_fclose(fp, buf) && character_dungeon) msg_format("Created %s", buf);
 }
 
 static void _csv_file(cptr name, _file_fn fn)
@@ -40,12 +111,12 @@ static void _csv_file(cptr name, _file_fn fn)
     char    buf[1024];
 
     path_build(buf, sizeof(buf), ANGBAND_DIR_HELP, name);
-    fp = my_fopen(buf, "w");
+    fp = spoiler_fopen(buf);
 
     if (!fp)
     {
         path_build(buf, sizeof(buf), ANGBAND_DIR_USER, name);
-        fp = my_fopen(buf, "w");
+        fp = spoiler_fopen(buf);
 
         if (!fp)
         {
@@ -57,8 +128,7 @@ static void _csv_file(cptr name, _file_fn fn)
 
     fn(fp);
 
-    my_fclose(fp);
-    if (character_dungeon) msg_format("Created %s", buf);
+    if (spoiler_fclose(fp, buf) && character_dungeon) msg_format("Created %s", buf);
 }
 
 /******************************************************************************
@@ -1915,11 +1985,11 @@ static void _generate_html_help_aux(cptr name, str_map_ptr prev, int format)
         }
         dest_path = _file_parts_build_fullname(dfp);
 
-        fff = my_fopen(string_buffer(dest_path), "w");
+        fff = spoiler_fopen(string_buffer(dest_path));
         if (fff)
         {
             doc_write_file(doc, fff, format);
-            my_fclose(fff);
+            spoiler_fclose(fff, string_buffer(dest_path));
         }
         _file_parts_free(dfp);
         string_free(dest_path);
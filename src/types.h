@@ -756,6 +756,27 @@ struct monster_type
     s32b pexp;    /* player experience gained (x100). kept <= r_ptr->mexp */
 };
 
+/*
+ * The few fields of monster_type that process_monsters() reads for every
+ * monster on every game turn, mirrored in m_hot[] (parallel to m_list[])
+ * so that the scan can pass over dead, distant and idle monsters without
+ * touching their monster_type. Kept current by mon_hot_sync(), which also
+ * maintains the m_hot_active[] bitmap: live monsters that are being born,
+ * have timers other than sleep running or are within AAF_LIMIT. The rest
+ * (including far sleepers) are dormant and cost process_monsters() nothing
+ * until one of those changes.
+ */
+enum {
+    MHOT_LIVE  = 0x01,  /* r_idx != 0 */
+    MHOT_BORN  = 0x02,  /* mflag & MFLAG_BORN */
+    MHOT_TIMED = 0x04,  /* process_mon_mtimed() has something to count down */
+};
+
+typedef struct {
+    byte cdis;
+    byte flags;
+} mon_hot_t, *mon_hot_ptr;
+
 enum {
     AI_SEEK = 0,
     AI_LURE = 1,
@@ -2195,6 +2195,9 @@ char inkey(void)
         /* Hack -- Flush output once when no key ready */
         if (!done && (0 != Term_inkey(&kk, FALSE, FALSE)))
         {
+            /* Draw any pending list and map windows */
+            window_refresh();
+
             /* Hack -- activate proper term */
             Term_activate(old);
 
@@ -72,6 +72,7 @@ u16b sf_saves;            /* Number of "saves" during this life */
  */
 bool arg_fiddle;            /* Command arg -- Request fiddle mode */
 bool arg_wizard;            /* Command arg -- Request wizard mode */
+bool arg_spoilers;          /* Command arg -- Write spoilers and quit */
 bool arg_sound;                /* Command arg -- Request special sounds */
 byte arg_graphics;            /* Command arg -- Request graphics mode */
 bool arg_monochrome;        /* Command arg -- Request monochrome mode */
@@ -759,6 +760,16 @@ object_type *o_list;
  */
 monster_type *m_list;
 
+/*
+ * Hot per-turn monster state, parallel to m_list [max_m_idx]
+ */
+mon_hot_t *m_hot;
+
+/*
+ * One bit per m_list slot that process_monsters() must visit [(max_m_idx + 31) / 32]
+ */
+u32b *m_hot_active;
+
 pack_info_t *pack_info_list;
 s16b max_pack_info_idx;
 s16b pack_info_free_list;
@@ -1798,6 +1798,7 @@ bool _design_monkey_clone(void)
 
     r_ptr->r_xtra1 |= MR1_LORE;
 
+    mon_race_props_invalidate();
     return TRUE;
 }
 
@@ -219,6 +219,32 @@ static void kind_info(char *buf, char *dam, char *wgt, int *lev, s32b *val, int
 }
 
 
+/*
+ * In batch mode (generate_wizard_spoilers) the spoiler documents are
+ * written to the user directory as text rather than displayed.
+ */
+static bool _spoil_batch = FALSE;
+
+static void _spoil_show(doc_ptr doc, cptr caption, cptr name)
+{
+    if (_spoil_batch)
+    {
+        char  buf[1024];
+        FILE *fp;
+
+        path_build(buf, sizeof(buf), ANGBAND_DIR_USER, name);
+        fp = spoiler_fopen(buf);
+        if (fp)
+        {
+            doc_write_file(doc, fp, DOC_FORMAT_TEXT);
+            spoiler_fclose(fp, buf);
+        }
+    }
+    else
+        doc_display(doc, caption, 0);
+}
+
+
 /*
  * Create a spoiler file for items
  */
@@ -229,19 +255,20 @@ static void spoil_obj_desc(cptr fname)
     u16b who[200];
 
     char buf[1024];
+    char path[1024];
 
     char wgt[80];
     char dam[80];
 
 
     /* Build the filename */
-    path_build(buf, sizeof(buf), ANGBAND_DIR_USER, fname);
+    path_build(path, sizeof(path), ANGBAND_DIR_USER, fname);
 
     /* File type is "TEXT" */
     FILE_TYPE(FILE_TYPE_TEXT);
 
     /* Open the file */
-    fff = my_fopen(buf, "w");
+    fff = spoiler_fopen(path);
 
     /* Oops */
     if (!fff)
@@ -341,14 +368,16 @@ static void spoil_obj_desc(cptr fname)
 
 
     /* Check for errors */
-    if (ferror(fff) || my_fclose(fff))
+    if (ferror(fff))
     {
+        spoiler_fabort(fff, path);
         msg_print("Cannot close spoiler file.");
         return;
     }
+    spoiler_fclose(fff, path);
 
     /* Message */
-    msg_print("Successfully created a spoiler file.");
+    if (!_spoil_batch) msg_print("Successfully created a spoiler file.");
 }
 
 /************************************************************************
@@ -461,7 +490,7 @@ static void spoil_artifact_desc(void)
         }
     }
 
-    doc_display(doc, "Artifact Spoilers", 0);
+    _spoil_show(doc, "Artifact Spoilers", "art-desc.txt");
     doc_free(doc);
     spoiler_hack = FALSE;
 }
@@ -718,7 +747,7 @@ static void spoil_artifact_tables(void)
     _spoil_artifact_table_aux(doc, "Boots", object_is_boots);
     spoiler_hack = FALSE;
 
-    doc_display(doc, "Artifact Tables", 0);
+    _spoil_show(doc, "Artifact Tables", "art-tables.txt");
     doc_free(doc);
 }
 
@@ -845,7 +874,7 @@ static void spoil_mon_desc(void)
     _spoil_mon_table(doc, "Non-uniques", _mon_is_nonunique);
 
     doc_insert(doc, "</style>");
-    doc_display(doc, "Monster Tables", 0);
+    _spoil_show(doc, "Monster Tables", "mon-desc.txt");
     doc_free(doc);
 }
 
@@ -1545,7 +1574,7 @@ static void spoil_mon_spell_dam(void)
     doc_insert(doc, "</style>");
     doc_printf(doc, "\n<color:D>Generated for FrogComposband Version %d.%d.%s</color>\n\n",
                      VER_MAJOR, VER_MINOR, VER_PATCH);
-    doc_display(doc, "Monster Tables", 0);
+    _spoil_show(doc, "Monster Tables", "mon-spell-dam.txt");
     doc_free(doc);
     vec_free(v);
 }
@@ -1563,7 +1592,7 @@ static void spoil_mon_melee_dam(void)
     doc_insert(doc, "</style>");
     doc_printf(doc, "\n<color:D>Generated for FrogComposband Version %d.%d.%s</color>\n\n",
                      VER_MAJOR, VER_MINOR, VER_PATCH);
-    doc_display(doc, "Monster Tables", 0);
+    _spoil_show(doc, "Monster Tables", "mon-melee-dam.txt");
     doc_free(doc);
     vec_free(v);
 }
@@ -1603,7 +1632,7 @@ static void spoil_mon_non_nice(void)
     doc_insert(doc, "</style>");
     doc_printf(doc, "\n<color:D>Generated for FrogComposband Version %d.%d.%s</color>\n\n",
                      VER_MAJOR, VER_MINOR, VER_PATCH);
-    doc_display(doc, "Monster Tables", 0);
+    _spoil_show(doc, "Monster Tables", "mon-non-nice.txt");
     doc_free(doc);
     vec_free(v);
 }
@@ -1680,7 +1709,7 @@ static void spoil_mon_resist(void)
     doc_insert(doc, "</style>");
     doc_printf(doc, "\n<color:D>Generated for FrogComposband Version %d.%d.%s</color>\n\n",
                      VER_MAJOR, VER_MINOR, VER_PATCH);
-    doc_display(doc, "Monster Tables", 0);
+    _spoil_show(doc, "Monster Tables", "mon-resist.txt");
     doc_free(doc);
     vec_free(v);
 }
@@ -1987,7 +2016,7 @@ static void spoil_mon_info(void)
     }
     vec_free(v);
 
-    doc_display(doc, "Monster Spoilers", 0);
+    _spoil_show(doc, "Monster Spoilers", "mon-info.txt");
     doc_free(doc);
 
     spoiler_hack = FALSE;
@@ -2065,7 +2094,7 @@ static void spoil_mon_evol(void)
     vec_free(roots);
 
     doc_insert(doc, "</style>");
-    doc_display(doc, "Monster Evolution", 0);
+    _spoil_show(doc, "Monster Evolution", "mon-evol.txt");
     doc_free(doc);
 }
 
@@ -2110,7 +2139,7 @@ static void spoil_shared_symbols(void)
     }
 
     doc_insert(doc, "</style>");
-    doc_display(doc, "Monsters Sharing Symbols", 0);
+    _spoil_show(doc, "Monsters Sharing Symbols", "mon-symbols.txt");
     doc_free(doc);
 }
 
@@ -2228,7 +2257,7 @@ static void spoil_skills()
     doc_insert(doc, "</style>");
     doc_printf(doc, "\n<color:D>Generated for FrogComposband %d.%d.%s</color>\n",
                      VER_MAJOR, VER_MINOR, VER_PATCH);
-    doc_display(doc, "Skills", 0);
+    _spoil_show(doc, "Skills", "skills.txt");
     doc_free(doc);
 }
 
@@ -2346,7 +2375,7 @@ static void spoil_spells_by_class(void)
         }
     }
 
-    doc_display(doc, "Spells by Class", 0);
+    _spoil_show(doc, "Spells by Class", "spells-class.txt");
     doc_free(doc);
     vec_free(vec);
 }
@@ -2816,6 +2845,33 @@ void do_cmd_spoilers(void)
     screen_load();
 }
 
+/*
+ * Write every non-interactive spoiler above to the user directory
+ * (see the -s command line option).
+ */
+void generate_wizard_spoilers(void)
+{
+    _spoil_batch = TRUE;
+
+    spoil_obj_desc("obj-desc.spo");
+    spoil_artifact_desc();
+    spoil_artifact_tables();
+
+    spoil_mon_desc();
+    spoil_mon_info();
+    spoil_mon_evol();
+    spoil_shared_symbols();
+    spoil_mon_non_nice();
+    spoil_mon_spell_dam();
+    spoil_mon_melee_dam();
+    spoil_mon_resist();
+
+    spoil_spells_by_class();
+    spoil_skills();
+
+    _spoil_batch = FALSE;
+}
+
 
 #else
 
@@ -27,14 +27,14 @@ static vec_ptr _egos = NULL;
 vec_ptr stats_rand_arts(void)
 {
     if (!_rand_arts)
-        _rand_arts = vec_alloc(free);
+        _rand_arts = vec_alloc((vec_free_f)obj_free);
     return _rand_arts;
 }
 
 vec_ptr stats_egos(void)
 {
     if (!_egos)
-        _egos = vec_alloc(free);
+        _egos = vec_alloc((vec_free_f)obj_free);
     return _egos;
 }
 
@@ -42,8 +42,7 @@ void stats_add_rand_art(object_type *o_ptr)
 {
     if (o_ptr->art_name)
     {
-        object_type *copy = malloc(sizeof(object_type));
-        *copy = *o_ptr;
+        object_type *copy = obj_copy(o_ptr);
         no_karrot_hack = TRUE;
         obj_identify_fully(copy);
         no_karrot_hack = FALSE;
@@ -55,8 +54,7 @@ void stats_add_ego(object_type *o_ptr)
 {
     if (o_ptr->name2)
     {
-        object_type *copy = malloc(sizeof(object_type));
-        *copy = *o_ptr;
+        object_type *copy = obj_copy(o_ptr);
         obj_identify_fully(copy);
         vec_add(stats_egos(), copy);
     }
@@ -1739,6 +1737,13 @@ void do_cmd_debug(void)
         self_knowledge();
         break;
 
+    /* Small block allocator counters */
+    case 'K':
+        msg_format("Slab: %ld allocs (%ld reused), %ld frees, %ld blocks (%ld bytes) held.",
+            slab_stats.allocs, slab_stats.hits, slab_stats.frees,
+            slab_stats.blocks, slab_stats.bytes);
+        break;
+
     /* Learn about objects */
     case 'l':
         do_cmd_wiz_learn();
@@ -1807,7 +1812,7 @@ void do_cmd_debug(void)
         {
             mon_ptr mon = &m_list[target_who];
             doc_ptr doc = doc_alloc(80);
-            mon_spell_wizard(mon, NULL, doc);
+            mon_spell_wizard(mon, doc);
             doc_display(doc, "Spells", 0);
             doc_free(doc);
             do_cmd_redraw();
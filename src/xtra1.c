@@ -3822,6 +3822,12 @@ void calc_bonuses(void)
 
     s16b stats[MAX_STATS] = {0};
 
+    /* Spell menu info may depend on anything below */
+    spell_memo_invalidate();
+
+    /* So may object descriptions (damage dice, multipliers, device power) */
+    object_desc_invalidate();
+
     /* Clear the stat modifiers */
     for (i = 0; i < 6; i++) p_ptr->stat_add[i] = 0;
 
@@ -5790,6 +5796,28 @@ void redraw_stuff(void)
 }
 
 
+/*
+ * The list and map windows rebuild their entire contents, and monster
+ * movement flags them many times per player turn. window_stuff() leaves
+ * them pending and window_refresh() draws them when the player can
+ * actually look: once per player action and when inkey() is about to
+ * wait. Terminal output is diffed by Term_fresh(), so only the rows that
+ * changed are actually repainted.
+ */
+#define PW_DEFERRED (PW_OVERHEAD | PW_DUNGEON | PW_OBJECT_LIST | PW_MONSTER_LIST)
+
+static bool _window_refresh = FALSE;
+
+void window_refresh(void)
+{
+    if (!character_dungeon) return;
+    if (!(p_ptr->window & PW_DEFERRED)) return;
+
+    _window_refresh = TRUE;
+    window_stuff();
+    _window_refresh = FALSE;
+}
+
 /*
  * Handle "p_ptr->window"
  */
@@ -5845,6 +5873,23 @@ void window_stuff(void)
         fix_message();
     }
 
+    /* Display monster recall */
+    if (p_ptr->window & (PW_MONSTER))
+    {
+        p_ptr->window &= ~(PW_MONSTER);
+        fix_monster();
+    }
+
+    /* Display object recall */
+    if (p_ptr->window & (PW_OBJECT))
+    {
+        p_ptr->window &= ~(PW_OBJECT);
+        fix_object();
+    }
+
+    /* Wait for window_refresh() */
+    if (!_window_refresh) return;
+
     /* Display overhead view */
     if (p_ptr->window & (PW_OVERHEAD))
     {
@@ -5859,13 +5904,6 @@ void window_stuff(void)
         fix_dungeon();
     }
 
-    /* Display monster recall */
-    if (p_ptr->window & (PW_MONSTER))
-    {
-        p_ptr->window &= ~(PW_MONSTER);
-        fix_monster();
-    }
-
     if (p_ptr->window & PW_OBJECT_LIST)
     {
         p_ptr->window &= ~(PW_OBJECT_LIST);
@@ -5877,13 +5915,6 @@ void window_stuff(void)
         p_ptr->window &= ~(PW_MONSTER_LIST);
         fix_monster_list();
     }
-
-    /* Display object recall */
-    if (p_ptr->window & (PW_OBJECT))
-    {
-        p_ptr->window &= ~(PW_OBJECT);
-        fix_object();
-    }
 }
 
 
@@ -201,7 +201,7 @@ static doc_style_f _get_doc_style_f(doc_ptr doc, cptr name)
 
 doc_ptr doc_alloc(int width)
 {
-    doc_ptr     res = malloc(sizeof(doc_t));
+    doc_ptr     res = slab_alloc(sizeof(doc_t));
     doc_style_t style = {0};
 
     res->cursor.x = 0;
@@ -215,6 +215,7 @@ doc_ptr doc_alloc(int width)
     res->style_stack = vec_alloc(free);
     res->name = string_alloc();
     res->html_header = string_alloc();
+    res->stream = NULL;
 
     /* Default Styles */
     _add_doc_style_f(res, "normal", _normal_style);
@@ -248,8 +249,9 @@ void doc_free(doc_ptr doc)
         vec_free(doc->style_stack);
         string_free(doc->name);
         string_free(doc->html_header);
+        free(doc->stream);
 
-        free(doc);
+        slab_free(doc, sizeof(doc_t));
     }
 }
 
@@ -1259,6 +1261,8 @@ doc_pos_t doc_insert_cols(doc_ptr dest_doc, doc_ptr src_cols[], int col_count, i
     return dest_doc->cursor;
 }
 
+static void _doc_stream_flush(doc_ptr doc, int page_num);
+
 doc_char_ptr doc_char(doc_ptr doc, doc_pos_t pos)
 {
     int            cb = doc->width * PAGE_HEIGHT * sizeof(doc_char_t);
@@ -1271,9 +1275,12 @@ doc_char_ptr doc_char(doc_ptr doc, doc_pos_t pos)
         page = malloc(cb);
         memset(page, 0, cb);
         vec_add(doc->pages, page);
+        if (doc->stream)
+            _doc_stream_flush(doc, page_num);
     }
 
     page = vec_get(doc->pages, page_num);
+    assert(page); /* streamed out: see doc_begin_stream() */
 
     assert(0 <= doc->cursor.x && doc->cursor.x < doc->width);
     assert(offset * doc->width + pos.x < cb);
@@ -1289,29 +1296,6 @@ doc_pos_t doc_read_file(doc_ptr doc, FILE *fp)
     return doc->cursor;
 }
 
-static void _doc_write_text_file(doc_ptr doc, FILE *fp)
-{
-    doc_pos_t    pos;
-    doc_char_ptr cell;
-
-    for (pos.y = 0; pos.y <= doc->cursor.y; pos.y++)
-    {
-        int cx = doc->width;
-        pos.x = 0;
-        if (pos.y == doc->cursor.y)
-            cx = doc->cursor.x;
-        cell = doc_char(doc, pos);
-        for (; pos.x < cx; pos.x++)
-        {
-            if (!cell->c) break;
-            fputc(cell->c, fp);
-            cell++;
-        }
-        fprintf(fp, "\n");
-        /*fputc('\n', fp);*/
-   }
-}
-
 static int _compare_links(doc_link_ptr left, doc_link_ptr right)
 {
     return doc_pos_compare(left->location.start, right->location.start);
@@ -1334,165 +1318,274 @@ vec_ptr doc_get_links(doc_ptr doc)
     return links;
 }
 
-static void _doc_write_html_file(doc_ptr doc, FILE *fp)
+/* Documents are written a line at a time so that doc_write_file() and
+   doc_begin_stream() share the same output code. */
+struct doc_stream_s
 {
-    doc_pos_t        pos;
-    doc_char_ptr     cell;
-    byte             old_a = _INVALID_COLOR;
-    int              bookmark_idx = 0;
-    doc_bookmark_ptr next_bookmark = NULL;
-    vec_ptr          links = doc_get_links(doc);
-    int              link_idx = 0;
-    doc_link_ptr     next_link = NULL;
+    FILE *fp;
+    int   format;
+    int   line;     /* next line to write */
+    int   page;     /* pages below this have been written and released */
+    bool  started;
+    byte  old_a;
+    int   bookmark_idx;
+};
 
-    if (bookmark_idx < vec_length(doc->bookmarks))
-        next_bookmark = vec_get(doc->bookmarks, bookmark_idx);
+static void _doc_write_begin(doc_ptr doc, doc_stream_ptr w)
+{
+    w->started = TRUE;
+    switch (w->format)
+    {
+    case DOC_FORMAT_HTML:
+        fprintf(w->fp, "<!DOCTYPE html>\n<html>\n");
+        if (string_length(doc->html_header))
+            fprintf(w->fp, "%s\n", string_buffer(doc->html_header));
+        fprintf(w->fp, "<body text=\"#ffffff\" bgcolor=\"#000000\"><pre>\n");
+        break;
+    case DOC_FORMAT_DOC:
+        fputs("<style:wide>", w->fp);
+        break;
+    }
+}
 
-    if (link_idx < vec_length(links))
-        next_link = vec_get(links, link_idx);
+static void _doc_write_end(doc_ptr doc, doc_stream_ptr w)
+{
+    switch (w->format)
+    {
+    case DOC_FORMAT_HTML:
+        fprintf(w->fp, "</font>");
+        fprintf(w->fp, "</pre></body></html>\n");
+        break;
+    case DOC_FORMAT_DOC:
+        fputs("</style>", w->fp);
+        break;
+    }
+}
+
+static int _doc_line_width(doc_ptr doc, int y)
+{
+    if (y == doc->cursor.y)
+        return doc->cursor.x;
+    return doc->width;
+}
 
-    fprintf(fp, "<!DOCTYPE html>\n<html>\n");
-    if (string_length(doc->html_header))
-        fprintf(fp, "%s\n", string_buffer(doc->html_header));
-    fprintf(fp, "<body text=\"#ffffff\" bgcolor=\"#000000\"><pre>\n");
+static void _doc_write_text_line(doc_ptr doc, doc_stream_ptr w, int y)
+{
+    doc_pos_t    pos = doc_pos_create(0, y);
+    doc_char_ptr cell = doc_char(doc, pos);
+    int          cx = _doc_line_width(doc, y);
 
-    for (pos.y = 0; pos.y <= doc->cursor.y; pos.y++)
+    for (; pos.x < cx; pos.x++)
     {
-        int cx = doc->width;
-        pos.x = 0;
-        if (pos.y == doc->cursor.y)
-            cx = doc->cursor.x;
-        cell = doc_char(doc, pos);
+        if (!cell->c) break;
+        fputc(cell->c, w->fp);
+        cell++;
+    }
+    fprintf(w->fp, "\n");
+}
+
+static void _doc_write_html_line(doc_ptr doc, doc_stream_ptr w, int y, vec_ptr links, int *link_idx)
+{
+    doc_pos_t        pos = doc_pos_create(0, y);
+    doc_char_ptr     cell = doc_char(doc, pos);
+    int              cx = _doc_line_width(doc, y);
+    FILE            *fp = w->fp;
+    doc_link_ptr     next_link = NULL;
+
+    if (*link_idx < vec_length(links))
+        next_link = vec_get(links, *link_idx);
 
-        if (next_bookmark && pos.y == next_bookmark->pos.y)
+    if (w->bookmark_idx < vec_length(doc->bookmarks))
+    {
+        doc_bookmark_ptr next_bookmark = vec_get(doc->bookmarks, w->bookmark_idx);
+        if (pos.y == next_bookmark->pos.y)
         {
             fprintf(fp, "<a name=\"%s\"></a>", string_buffer(next_bookmark->name));
-            bookmark_idx++;
-            if (bookmark_idx < vec_length(doc->bookmarks))
-                next_bookmark = vec_get(doc->bookmarks, bookmark_idx);
-            else
-                next_bookmark = NULL;
+            w->bookmark_idx++;
         }
+    }
 
-        for (; pos.x < cx; pos.x++)
-        {
-            char c = cell->c;
-            byte a = cell->a % MAX_COLOR;
+    for (; pos.x < cx; pos.x++)
+    {
+        char c = cell->c;
+        byte a = cell->a % MAX_COLOR;
 
-            if (next_link)
+        if (next_link)
+        {
+            if (doc_pos_compare(next_link->location.start, pos) == 0)
             {
-                if (doc_pos_compare(next_link->location.start, pos) == 0)
-                {
-                    string_ptr s;
-                    int        pos = string_last_chr(next_link->file, '.');
+                string_ptr s;
+                int        pos = string_last_chr(next_link->file, '.');
 
-                    if (pos >= 0)
-                    {
-                        s = string_copy_sn(string_buffer(next_link->file), pos + 1);
-                        string_append_s(s, "html");
-                    }
-                    else
-                        s = string_copy(next_link->file);
-
-                    fprintf(fp, "<a href=\"%s", string_buffer(s));
-                    if (next_link->topic)
-                        fprintf(fp, "#%s", string_buffer(next_link->topic));
-                    fprintf(fp, "\">");
-
-                    string_free(s);
-                }
-                if (doc_pos_compare(next_link->location.stop, pos) == 0)
+                if (pos >= 0)
                 {
-                    fprintf(fp, "</a>");
-                    link_idx++;
-                    if (link_idx < vec_length(links))
-                        next_link = vec_get(links, link_idx);
-                    else
-                        next_link = NULL;
+                    s = string_copy_sn(string_buffer(next_link->file), pos + 1);
+                    string_append_s(s, "html");
                 }
-            }
+                else
+                    s = string_copy(next_link->file);
 
-            if (!c) break;
+                fprintf(fp, "<a href=\"%s", string_buffer(s));
+                if (next_link->topic)
+                    fprintf(fp, "#%s", string_buffer(next_link->topic));
+                fprintf(fp, "\">");
 
-            if (a != old_a && c != ' ')
-            {
-                if (old_a != _INVALID_COLOR)
-                    fprintf(fp, "</font>");
-                fprintf(fp,
-                    "<font color=\"#%02x%02x%02x\">",
-                    angband_color_table[a][1],
-                    angband_color_table[a][2],
-                    angband_color_table[a][3]
-                );
-                old_a = a;
+                string_free(s);
             }
-            switch (c)
+            if (doc_pos_compare(next_link->location.stop, pos) == 0)
             {
-            case '&': fprintf(fp, "&amp;"); break;
-            case '<': fprintf(fp, "&lt;"); break;
-            case '>': fprintf(fp, "&gt;"); break;
-            default:  fprintf(fp, "%c", c); break;
+                fprintf(fp, "</a>");
+                (*link_idx)++;
+                if (*link_idx < vec_length(links))
+                    next_link = vec_get(links, *link_idx);
+                else
+                    next_link = NULL;
             }
-            cell++;
         }
-        fputc('\n', fp);
-   }
-   fprintf(fp, "</font>");
-   fprintf(fp, "</pre></body></html>\n");
 
-   vec_free(links);
+        if (!c) break;
+
+        if (a != w->old_a && c != ' ')
+        {
+            if (w->old_a != _INVALID_COLOR)
+                fprintf(fp, "</font>");
+            fprintf(fp,
+                "<font color=\"#%02x%02x%02x\">",
+                angband_color_table[a][1],
+                angband_color_table[a][2],
+                angband_color_table[a][3]
+            );
+            w->old_a = a;
+        }
+        switch (c)
+        {
+        case '&': fprintf(fp, "&amp;"); break;
+        case '<': fprintf(fp, "&lt;"); break;
+        case '>': fprintf(fp, "&gt;"); break;
+        default:  fprintf(fp, "%c", c); break;
+        }
+        cell++;
+    }
+    fputc('\n', fp);
 }
 
-static void _doc_write_doc_file(doc_ptr doc, FILE *fp)
+static void _doc_write_doc_line(doc_ptr doc, doc_stream_ptr w, int y)
 {
-    doc_pos_t        pos;
-    doc_char_ptr     cell;
-    byte             old_a = _INVALID_COLOR;
+    doc_pos_t    pos = doc_pos_create(0, y);
+    doc_char_ptr cell = doc_char(doc, pos);
+    int          cx = _doc_line_width(doc, y);
 
-    fputs("<style:wide>", fp);
-    for (pos.y = 0; pos.y <= doc->cursor.y; pos.y++)
+    for (; pos.x < cx; pos.x++)
     {
-        int cx = doc->width;
-        pos.x = 0;
-        if (pos.y == doc->cursor.y)
-            cx = doc->cursor.x;
-        cell = doc_char(doc, pos);
+        char c = cell->c;
+        byte a = cell->a;
+
+        if (!c) break;
 
-        for (; pos.x < cx; pos.x++)
+        if (a != w->old_a && c != ' ')
         {
-            char c = cell->c;
-            byte a = cell->a;
+            if (w->old_a != _INVALID_COLOR)
+                fputs("</color>", w->fp);
+            fprintf(w->fp, "<color:%c>", attr_to_attr_char(a));
+            w->old_a = a;
+        }
+        fputc(c, w->fp);
+        cell++;
+    }
+    fputc('\n', w->fp);
+}
 
-            if (!c) break;
+/* Write lines [w->line, stop_y) */
+static void _doc_write_lines(doc_ptr doc, doc_stream_ptr w, int stop_y)
+{
+    vec_ptr links = NULL;
+    int     link_idx = 0;
 
-            if (a != old_a && c != ' ')
-            {
-                if (old_a != _INVALID_COLOR)
-                    fputs("</color>", fp);
-                fprintf(fp, "<color:%c>", attr_to_attr_char(a));
-                old_a = a;
-            }
-            fputc(c, fp);
-            cell++;
+    if (!w->started)
+        _doc_write_begin(doc, w);
+
+    if (w->format == DOC_FORMAT_HTML)
+    {
+        /* Links are only added at the cursor, so any link still open was
+           started in a line we have already written */
+        links = doc_get_links(doc);
+        while (link_idx < vec_length(links))
+        {
+            doc_link_ptr link = vec_get(links, link_idx);
+            if (doc_pos_compare(link->location.stop, doc_pos_create(0, w->line)) >= 0)
+                break;
+            link_idx++;
         }
-        fputc('\n', fp);
-   }
-    fputs("</style>", fp);
+    }
+
+    for (; w->line < stop_y; w->line++)
+    {
+        switch (w->format)
+        {
+        case DOC_FORMAT_HTML:
+            _doc_write_html_line(doc, w, w->line, links, &link_idx);
+            break;
+        case DOC_FORMAT_DOC:
+            _doc_write_doc_line(doc, w, w->line);
+            break;
+        default:
+            _doc_write_text_line(doc, w, w->line);
+        }
+    }
+
+    if (links)
+        vec_free(links);
+}
+
+static void _doc_stream_init(doc_stream_ptr w, FILE *fp, int format)
+{
+    memset(w, 0, sizeof(doc_stream_t));
+    w->fp = fp;
+    w->format = format;
+    w->old_a = _INVALID_COLOR;
 }
 
 void doc_write_file(doc_ptr doc, FILE *fp, int format)
 {
-    switch (format)
-    {
-    case DOC_FORMAT_HTML:
-        _doc_write_html_file(doc, fp);
-        break;
-    case DOC_FORMAT_DOC:
-        _doc_write_doc_file(doc, fp);
-        break;
-    default:
-        _doc_write_text_file(doc, fp);
-    }
+    doc_stream_t w;
+
+    assert(!doc->stream);
+    _doc_stream_init(&w, fp, format);
+    _doc_write_lines(doc, &w, doc->cursor.y + 1);
+    _doc_write_end(doc, &w);
+}
+
+void doc_begin_stream(doc_ptr doc, FILE *fp, int format)
+{
+    assert(!doc->stream);
+    doc->stream = malloc(sizeof(doc_stream_t));
+    _doc_stream_init(doc->stream, fp, format);
+}
+
+/* Called as the document grows into page_num. Text is only ever added
+   at or after the cursor, so earlier lines are final; we still keep the
+   previous page in hand and flush everything before it. */
+static void _doc_stream_flush(doc_ptr doc, int page_num)
+{
+    doc_stream_ptr w = doc->stream;
+    int            stop = page_num - 1;
+
+    if (stop <= w->page) return;
+
+    _doc_write_lines(doc, w, stop * PAGE_HEIGHT);
+    for (; w->page < stop; w->page++)
+        vec_set(doc->pages, w->page, NULL);
+}
+
+void doc_end_stream(doc_ptr doc)
+{
+    doc_stream_ptr w = doc->stream;
+
+    if (!w) return;
+    _doc_write_lines(doc, w, doc->cursor.y + 1);
+    _doc_write_end(doc, w);
+    free(w);
+    doc->stream = NULL;
 }
 
 typedef void (*_doc_char_fn)(doc_pos_t pos, doc_char_ptr cell);
@@ -2117,6 +2210,114 @@ int weapon_exp_display(doc_ptr doc, cptr caption, int *top)
     }
     return (change_mode) ? 1 : 0;
 }
+/* Help files are parsed once and then kept, since following links back and
+ * forth would otherwise reread and relex the same few files over and over.
+ * Documents are keyed by name and width. A document stays pinned while a
+ * (possibly nested) display is showing it, and only unpinned documents are
+ * evicted, least recently used first. */
+#define _HELP_CACHE_MAX 16
+typedef struct {
+    string_ptr name;
+    int        width;
+    doc_ptr    doc;
+    int        pins;
+    int        used;
+} _help_doc_t, *_help_doc_ptr;
+
+static _help_doc_t _help_cache[_HELP_CACHE_MAX];
+static int         _help_clock = 0;
+
+static _help_doc_ptr _help_cache_find(cptr file_name, int width)
+{
+    int i;
+    for (i = 0; i < _HELP_CACHE_MAX; i++)
+    {
+        _help_doc_ptr entry = &_help_cache[i];
+        if ( entry->doc
+          && entry->width == width
+          && strcmp(string_buffer(entry->name), file_name) == 0 )
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static _help_doc_ptr _help_cache_slot(void)
+{
+    _help_doc_ptr result = NULL;
+    int           i;
+    for (i = 0; i < _HELP_CACHE_MAX; i++)
+    {
+        _help_doc_ptr entry = &_help_cache[i];
+        if (!entry->doc) return entry;
+        if (entry->pins) continue;
+        if (!result || entry->used < result->used)
+            result = entry;
+    }
+    if (result)
+    {
+        doc_free(result->doc);
+        string_free(result->name);
+        result->doc = NULL;
+        result->name = NULL;
+    }
+    return result;
+}
+
+/* Returns a pinned entry, or NULL if the file cannot be read */
+static _help_doc_ptr _help_cache_lock(cptr file_name, int width)
+{
+    _help_doc_ptr entry = _help_cache_find(file_name, width);
+
+    if (!entry)
+    {
+        char    path[1024];
+        FILE   *fp;
+        doc_ptr doc;
+
+        path_build(path, sizeof(path), ANGBAND_DIR_HELP, file_name);
+        fp = my_fopen(path, "r");
+        if (!fp) return NULL;
+
+        doc = doc_alloc(width);
+        doc_read_file(doc, fp);
+        my_fclose(fp);
+
+        entry = _help_cache_slot();
+        if (!entry)
+        {
+            /* Every slot is on screen: hand out an unshared doc */
+            entry = malloc(sizeof(_help_doc_t));
+            memset(entry, 0, sizeof(_help_doc_t));
+            entry->doc = doc;
+            entry->used = -1;
+            return entry;
+        }
+        entry->name = string_copy_s(file_name);
+        entry->width = width;
+        entry->doc = doc;
+        entry->pins = 0;
+    }
+    else
+        entry->doc->selection = doc_region_invalid();
+
+    entry->pins++;
+    entry->used = ++_help_clock;
+    return entry;
+}
+
+static void _help_cache_unlock(_help_doc_ptr entry)
+{
+    if (entry->used < 0) /* unshared */
+    {
+        doc_free(entry->doc);
+        free(entry);
+    }
+    else
+        entry->pins--;
+}
+
 int doc_display_help(cptr file_name, cptr topic)
 {
     rect_t display = {0};
@@ -2126,11 +2327,9 @@ int doc_display_help(cptr file_name, cptr topic)
 int doc_display_help_aux(cptr file_name, cptr topic, rect_t display)
 {
     int     rc = _OK;
-    FILE   *fp = NULL;
-    char    path[1024];
     char    caption[1024];
-    doc_ptr doc = NULL;
     int     top = 0;
+    _help_doc_ptr entry;
 
     /* Check for file_name#topic from a lazy client */
     if (!topic)
@@ -2147,27 +2346,22 @@ int doc_display_help_aux(cptr file_name, cptr topic, rect_t display)
     }
 
     sprintf(caption, "Help file '%s'", file_name);
-    path_build(path, sizeof(path), ANGBAND_DIR_HELP, file_name);
-    fp = my_fopen(path, "r");
-    if (!fp)
+    entry = _help_cache_lock(file_name, MIN(80, display.cx));
+    if (!entry)
     {
         cmsg_format(TERM_VIOLET, "Cannot open '%s'.", file_name);
         msg_print(NULL);
         return _OK;
     }
 
-    doc = doc_alloc(MIN(80, display.cx));
-    doc_read_file(doc, fp);
-    my_fclose(fp);
-
     if (topic)
     {
-        doc_pos_t pos = doc_find_bookmark(doc, topic);
+        doc_pos_t pos = doc_find_bookmark(entry->doc, topic);
         if (doc_pos_is_valid(pos))
             top = pos.y;
     }
 
-    rc = doc_display_aux(doc, caption, top, display);
-    doc_free(doc);
+    rc = doc_display_aux(entry->doc, caption, top, display);
+    _help_cache_unlock(entry);
     return rc;
 }
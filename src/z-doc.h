@@ -109,6 +109,8 @@ struct doc_link_s
 };
 typedef struct doc_link_s doc_link_t, *doc_link_ptr;
 
+typedef struct doc_stream_s doc_stream_t, *doc_stream_ptr;
+
 struct doc_s
 {
     doc_pos_t      cursor;
@@ -121,6 +123,7 @@ struct doc_s
     vec_ptr        style_stack;
     string_ptr     name;
     string_ptr     html_header;
+    doc_stream_ptr stream;
 };
 typedef struct doc_s doc_t, *doc_ptr;
 
@@ -168,6 +171,16 @@ doc_pos_t     doc_read_file(doc_ptr doc, FILE *fp);
               enum { DOC_FORMAT_TEXT, DOC_FORMAT_HTML, DOC_FORMAT_DOC };
 void          doc_write_file(doc_ptr doc, FILE *fp, int format);
 
+              /* Stream a document to a file as it is built. Lines are written
+                 and their pages released once the cursor has moved well past
+                 them, so the document must be built front to back: no rollback
+                 or lookups into earlier lines until doc_end_stream(), which
+                 writes the rest and detaches the file. The output is the same
+                 as doc_write_file() on the finished document, provided any html
+                 header is set before the first page is filled. */
+void          doc_begin_stream(doc_ptr doc, FILE *fp, int format);
+void          doc_end_stream(doc_ptr doc);
+
               /* Build a document in code */
 doc_pos_t     doc_insert_char(doc_ptr doc, byte a, char c);
 doc_pos_t     doc_insert_text(doc_ptr doc, byte a, cptr text);
@@ -74,6 +74,11 @@ u16b Rand_place;
  */
 u32b Rand_state[RAND_DEG];
 
+/*
+ * Current random stream, if any, used instead of the "complex" RNG
+ */
+RAND_THREAD_LOCAL rand_ctx_ptr Rand_ctx = NULL;
+
 
 /*
  * Initialize the "complex" RNG using a new seed
@@ -142,6 +147,12 @@ s32b Rand_div(u32b m)
         }
     }
 
+    /* Use the current random stream */
+    else if (Rand_ctx)
+    {
+        r = Rand_ctx_div(Rand_ctx, m);
+    }
+
     /* Use a complex RNG */
     else
     {
@@ -391,3 +402,147 @@ u32b Rand_simple(u32b m)
     /* Use the value */
     return (result);
 }
+
+
+
+/*
+ * Random streams (xoshiro128** by Blackman and Vigna)
+ *
+ * Each stream has 128 bits of state and a period of 2^128 - 1. Streams
+ * are seeded with splitmix32, so similar seeds give unrelated streams.
+ */
+static u32b _rotl(u32b x, int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+static u32b _splitmix32(u32b *x)
+{
+    u32b z = (*x += 0x9E3779B9);
+
+    z = (z ^ (z >> 16)) * 0x85EBCA6B;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35;
+    return z ^ (z >> 16);
+}
+
+/*
+ * Initialize a stream from a seed
+ */
+void Rand_ctx_seed(rand_ctx_ptr ctx, u32b seed)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) ctx->s[i] = _splitmix32(&seed);
+
+    /* The all zero state is a fixed point */
+    if (!(ctx->s[0] | ctx->s[1] | ctx->s[2] | ctx->s[3])) ctx->s[0] = 1;
+}
+
+/*
+ * Extract the next 32-bit number from a stream
+ */
+u32b Rand_ctx_next(rand_ctx_ptr ctx)
+{
+    u32b *s = ctx->s;
+    u32b result = _rotl(s[1] * 5, 7) * 9;
+    u32b t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = _rotl(s[3], 11);
+
+    return result;
+}
+
+/*
+ * Extract a number from 0 to m-1 from a stream, via "division"
+ * (cf Rand_div)
+ */
+s32b Rand_ctx_div(rand_ctx_ptr ctx, u32b m)
+{
+    u32b r, n;
+
+    /* Hack -- simple case */
+    if (m <= 1) return (0);
+
+    /* Partition size */
+    n = (0x10000000 / m);
+
+    /* Wait for it */
+    while (1)
+    {
+        /* Extract a 28-bit "random" number */
+        r = (Rand_ctx_next(ctx) >> 4) / n;
+
+        /* Done */
+        if (r < m) break;
+    }
+
+    /* Use the value */
+    return (r);
+}
+
+/*
+ * Split off a new stream. The child is seeded from the next outputs of
+ * the parent, so a parent may hand out any number of unrelated children.
+ */
+void Rand_ctx_split(rand_ctx_ptr ctx, rand_ctx_ptr child)
+{
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        u32b seed = Rand_ctx_next(ctx);
+        child->s[i] = _splitmix32(&seed);
+    }
+
+    if (!(child->s[0] | child->s[1] | child->s[2] | child->s[3])) child->s[0] = 1;
+}
+
+/*
+ * Advance a stream by 2^64 steps. Jumping a copy N times gives N
+ * non-overlapping subsequences of the original stream.
+ */
+void Rand_ctx_jump(rand_ctx_ptr ctx)
+{
+    static const u32b jump[4] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+    u32b s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    int  i, b;
+
+    for (i = 0; i < 4; i++)
+    {
+        for (b = 0; b < 32; b++)
+        {
+            if (jump[i] & (1U << b))
+            {
+                s0 ^= ctx->s[0];
+                s1 ^= ctx->s[1];
+                s2 ^= ctx->s[2];
+                s3 ^= ctx->s[3];
+            }
+            Rand_ctx_next(ctx);
+        }
+    }
+
+    ctx->s[0] = s0;
+    ctx->s[1] = s1;
+    ctx->s[2] = s2;
+    ctx->s[3] = s3;
+}
+
+/*
+ * Install a stream as the current one for this thread (NULL restores
+ * the global RNG). Returns the previous stream so callers can nest.
+ *
+ * Note that Rand_quick still takes precedence, so code seeding the
+ * "simple" RNG for flavors and wilderness works unchanged.
+ */
+rand_ctx_ptr Rand_ctx_set(rand_ctx_ptr ctx)
+{
+    rand_ctx_ptr old = Rand_ctx;
+    Rand_ctx = ctx;
+    return old;
+}
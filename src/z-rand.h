@@ -26,6 +26,18 @@
 #define RAND_DEG 63
 
 
+/*
+ * Thread-local storage for the "current" random stream (see Rand_ctx)
+ */
+#if defined(__GNUC__)
+# define RAND_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+# define RAND_THREAD_LOCAL __declspec(thread)
+#else
+# define RAND_THREAD_LOCAL
+#endif
+
+
 
 
 /**** Available macros ****/
@@ -81,12 +93,44 @@
     (randint0(100) < (S))
 
 
+/*
+ * Variants of the above which draw from an explicit random stream
+ */
+#define rand_ctx_int0(C,M) \
+    ((s32b)Rand_ctx_div((C),(M)))
+
+#define rand_ctx_int1(C,M) \
+    (rand_ctx_int0((C),(M)) + 1)
+
+#define rand_ctx_range(C,A,B) \
+    ((A) + (rand_ctx_int0((C),1+(B)-(A))))
+
+#define rand_ctx_one_in_(C,X) \
+    ((X) <= 0 || rand_ctx_int0((C),(X)) == 0)
+
+
+/**** Available Types ****/
+
+/*
+ * An independent random stream (xoshiro128**)
+ *
+ * Streams never touch the global Rand_state, so a subsystem may seed its
+ * own stream (or split one off another) and get reproducible numbers no
+ * matter what else the game has rolled. Installing a stream as Rand_ctx
+ * routes randint0() and friends through it.
+ */
+typedef struct {
+    u32b s[4];
+} rand_ctx_t, *rand_ctx_ptr;
+
+
 /**** Available Variables ****/
 
 extern bool Rand_quick;
 extern u32b Rand_value;
 extern u16b Rand_place;
 extern u32b Rand_state[RAND_DEG];
+extern RAND_THREAD_LOCAL rand_ctx_ptr Rand_ctx;
 
 
 /**** Available Functions ****/
@@ -99,6 +143,13 @@ extern s16b maxroll(int num, int sides);
 extern s32b div_round(s32b n, s32b d);
 extern u32b Rand_simple(u32b m);
 
+extern void Rand_ctx_seed(rand_ctx_ptr ctx, u32b seed);
+extern u32b Rand_ctx_next(rand_ctx_ptr ctx);
+extern s32b Rand_ctx_div(rand_ctx_ptr ctx, u32b m);
+extern void Rand_ctx_split(rand_ctx_ptr ctx, rand_ctx_ptr child);
+extern void Rand_ctx_jump(rand_ctx_ptr ctx);
+extern rand_ctx_ptr Rand_ctx_set(rand_ctx_ptr ctx);
+
 
 #endif
 
@@ -184,3 +184,81 @@ errr z_string_free(cptr str)
 }
 
 
+
+/*
+ * Small block slabs. Each size class is a singly linked list threaded
+ * through the first word of the free blocks themselves. Classes hold at
+ * most SLAB_DEPTH blocks so that a burst of frees (e.g. tearing down a
+ * large inventory copy) does not pin memory forever.
+ */
+#define SLAB_CLASSES (SLAB_MAX / SLAB_GRAIN)
+#define SLAB_DEPTH   256
+
+typedef struct slab_block_s slab_block_t;
+struct slab_block_s
+{
+    slab_block_t *next;
+};
+
+static slab_block_t *slab_heads[SLAB_CLASSES];
+static int           slab_counts[SLAB_CLASSES];
+
+slab_stats_t slab_stats = {0};
+
+static int _slab_class(huge len)
+{
+    if (len > SLAB_MAX) return -1;
+
+    /* Custom allocators get to see every request */
+    if (ralloc_aux || rnfree_aux) return -1;
+
+    return (int)((len - 1) / SLAB_GRAIN);
+}
+
+vptr slab_alloc(huge len)
+{
+    int           c;
+    slab_block_t *b;
+
+    if (len == 0) return (NULL);
+
+    slab_stats.allocs++;
+
+    c = _slab_class(len);
+    if (c < 0) return ralloc(len);
+
+    b = slab_heads[c];
+    if (!b) return ralloc((c + 1) * SLAB_GRAIN);
+
+    slab_heads[c] = b->next;
+    slab_counts[c]--;
+    slab_stats.hits++;
+    slab_stats.blocks--;
+    slab_stats.bytes -= (c + 1) * SLAB_GRAIN;
+
+    return (vptr)b;
+}
+
+vptr slab_free(vptr p, huge len)
+{
+    int           c;
+    slab_block_t *b = (slab_block_t *)p;
+
+    if (!p || len == 0) return (NULL);
+
+    slab_stats.frees++;
+
+    c = _slab_class(len);
+    if (c < 0) return rnfree(p, len);
+
+    if (slab_counts[c] >= SLAB_DEPTH)
+        return rnfree(p, (c + 1) * SLAB_GRAIN);
+
+    b->next = slab_heads[c];
+    slab_heads[c] = b;
+    slab_counts[c]++;
+    slab_stats.blocks++;
+    slab_stats.bytes += (c + 1) * SLAB_GRAIN;
+
+    return (NULL);
+}
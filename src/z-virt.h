@@ -168,6 +168,32 @@ extern cptr z_string_make(cptr str);
 extern errr z_string_free(cptr str);
 
 
+/*
+ * Small block slabs.
+ *
+ * slab_alloc() and slab_free() sit on top of ralloc() and rnfree() and keep
+ * freed blocks on per size class free lists (SLAB_GRAIN byte steps up to
+ * SLAB_MAX bytes) for reuse. Larger requests go straight to ralloc().
+ * A block from slab_alloc() must be returned with slab_free() and the same
+ * len, or with plain free().
+ */
+#define SLAB_GRAIN 16
+#define SLAB_MAX   1024
+
+typedef struct {
+    long allocs;   /* Calls to slab_alloc() */
+    long hits;     /* ... satisfied from a free list */
+    long frees;    /* Calls to slab_free() */
+    long blocks;   /* Blocks currently held on the free lists */
+    long bytes;    /* ... and their total size */
+} slab_stats_t;
+
+extern slab_stats_t slab_stats;
+
+extern vptr slab_alloc(huge len);
+extern vptr slab_free(vptr p, huge len);
+
+
 
 
 #endif